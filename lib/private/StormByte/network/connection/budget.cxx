@@ -0,0 +1,87 @@
+#include <StormByte/network/connection/budget.hxx>
+
+#include <utility>
+
+using namespace StormByte::Network::Connection;
+
+Budget::Ticket::Ticket(Budget& budget, const std::size_t& bytes) noexcept:
+	m_budget(&budget),
+	m_bytes(bytes) {}
+
+Budget::Ticket::Ticket(Ticket&& other) noexcept:
+	m_budget(std::exchange(other.m_budget, nullptr)),
+	m_bytes(other.m_bytes) {}
+
+Budget::Ticket::~Ticket() noexcept {
+	Release();
+}
+
+Budget::Ticket& Budget::Ticket::operator=(Ticket&& other) noexcept {
+	if (this != &other) {
+		Release();
+		m_budget = std::exchange(other.m_budget, nullptr);
+		m_bytes = other.m_bytes;
+	}
+	return *this;
+}
+
+void Budget::Ticket::Release() noexcept {
+	if (!m_budget)
+		return;
+	m_budget->m_requests.fetch_sub(1, std::memory_order_acq_rel);
+	m_budget->m_bytes.fetch_sub(m_bytes, std::memory_order_acq_rel);
+	m_budget = nullptr;
+}
+
+Budget::Budget(const AdmissionOptions& options) noexcept:
+	m_options(options),
+	m_connections(0),
+	m_requests(0),
+	m_bytes(0),
+	m_rejected(0),
+	m_shed(0) {}
+
+bool Budget::AdmitConnection() noexcept {
+	const std::size_t connections = m_connections.fetch_add(1, std::memory_order_acq_rel);
+	if (m_options.max_connections > 0 && connections >= m_options.max_connections) {
+		m_connections.fetch_sub(1, std::memory_order_acq_rel);
+		m_rejected.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+	return true;
+}
+
+void Budget::ReleaseConnection() noexcept {
+	m_connections.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+std::optional<Budget::Ticket> Budget::AdmitRequest(const std::size_t& bytes) noexcept {
+	const std::size_t requests = m_requests.fetch_add(1, std::memory_order_acq_rel);
+	const std::size_t buffered = m_bytes.fetch_add(bytes, std::memory_order_acq_rel);
+	const bool over_requests = m_options.max_requests > 0 && requests >= m_options.max_requests;
+	const bool over_bytes = m_options.max_buffered_bytes > 0 && buffered > 0 && buffered + bytes > m_options.max_buffered_bytes;
+	if (over_requests || over_bytes) {
+		m_requests.fetch_sub(1, std::memory_order_acq_rel);
+		m_bytes.fetch_sub(bytes, std::memory_order_acq_rel);
+		m_shed.fetch_add(1, std::memory_order_relaxed);
+		return std::nullopt;
+	}
+	return std::optional<Ticket>(std::in_place, *this, bytes);
+}
+
+void Budget::Buffered(const std::size_t& now, const std::size_t& before) noexcept {
+	if (now > before)
+		m_bytes.fetch_add(now - before, std::memory_order_acq_rel);
+	else
+		m_bytes.fetch_sub(before - now, std::memory_order_acq_rel);
+}
+
+AdmissionStats Budget::Stats() const noexcept {
+	return AdmissionStats {
+		.connections = m_connections.load(std::memory_order_acquire),
+		.requests = m_requests.load(std::memory_order_acquire),
+		.buffered_bytes = m_bytes.load(std::memory_order_acquire),
+		.rejected_connections = m_rejected.load(std::memory_order_relaxed),
+		.shed_requests = m_shed.load(std::memory_order_relaxed),
+	};
+}
@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <StormByte/network/connection/admission.hxx>
+
+#include <atomic>
+#include <optional>
+
+/**
+ * @namespace Connection
+ * @brief Connection-level types (protocol, status, read/write results).
+ */
+namespace StormByte::Network::Connection {
+	/**
+	 * @class Budget
+	 * @brief Lock-free admission counters shared by a server and its outboxes.
+	 *
+	 * Each limit is checked by optimistically reserving and backing out when
+	 * over it, so concurrent admissions never overshoot. Shared by
+	 * std::shared_ptr, since outboxes may outlive their server.
+	 */
+	class STORMBYTE_NETWORK_PRIVATE Budget final {
+		public:
+			/**
+			 * @class Ticket
+			 * @brief Admitted request; releases its reservation when destroyed.
+			 */
+			class STORMBYTE_NETWORK_PRIVATE Ticket final {
+				public:
+					/**
+					 * @param budget Owning budget.
+					 * @param bytes Reserved payload bytes.
+					 */
+					Ticket(Budget& budget, const std::size_t& bytes) noexcept;
+
+					/**
+					 * Copy constructor (deleted).
+					 */
+					Ticket(const Ticket& other) = delete;
+
+					/**
+					 * Move constructor.
+					 */
+					Ticket(Ticket&& other) noexcept;
+
+					/**
+					 * Destructor (releases the reservation).
+					 */
+					~Ticket() noexcept;
+
+					/**
+					 * Copy assignment (deleted).
+					 */
+					Ticket& operator=(const Ticket& other) = delete;
+
+					/**
+					 * Move assignment (releases the current reservation).
+					 */
+					Ticket& operator=(Ticket&& other) noexcept;
+
+				private:
+					Budget* m_budget;		///< Owning budget (nullptr once moved from)
+					std::size_t m_bytes;	///< Reserved payload bytes
+
+					/**
+					 * Returns the reservation to the budget (once).
+					 */
+					void Release() noexcept;
+			};
+
+			/**
+			 * @param options Limits (0 = unlimited).
+			 */
+			explicit Budget(const AdmissionOptions& options) noexcept;
+
+			/**
+			 * Copy constructor (deleted).
+			 */
+			Budget(const Budget& other) = delete;
+
+			/**
+			 * Move constructor (deleted).
+			 */
+			Budget(Budget&& other) noexcept = delete;
+
+			/**
+			 * Destructor.
+			 */
+			~Budget() noexcept = default;
+
+			/**
+			 * Copy assignment (deleted).
+			 */
+			Budget& operator=(const Budget& other) = delete;
+
+			/**
+			 * Move assignment (deleted).
+			 */
+			Budget& operator=(Budget&& other) noexcept = delete;
+
+			/**
+			 * Counts a new connection unless at AdmissionOptions::max_connections.
+			 * @return false (counted as rejected) when at the limit.
+			 */
+			bool AdmitConnection() noexcept;
+
+			/**
+			 * Releases a connection counted by @ref AdmitConnection().
+			 */
+			void ReleaseConnection() noexcept;
+
+			/**
+			 * Reserves a request slot and its payload bytes. A request is always
+			 * admitted when nothing is buffered, so an oversized one cannot
+			 * wedge the server.
+			 * @param bytes Request payload size.
+			 * @return Ticket, or std::nullopt (counted as shed) when over a limit.
+			 */
+			std::optional<Ticket> AdmitRequest(const std::size_t& bytes) noexcept;
+
+			/**
+			 * Adjusts the buffered byte count for an outbound queue.
+			 * @param now Bytes queued now.
+			 * @param before Bytes previously accounted for.
+			 */
+			void Buffered(const std::size_t& now, const std::size_t& before) noexcept;
+
+			/**
+			 * @return Current load and counters.
+			 */
+			AdmissionStats Stats() const noexcept;
+
+		private:
+			const AdmissionOptions m_options;					///< Limits
+			std::atomic<std::size_t> m_connections;				///< Connected clients
+			std::atomic<std::size_t> m_requests;				///< Requests in progress
+			std::atomic<std::size_t> m_bytes;					///< Buffered bytes
+			std::atomic<std::uint64_t> m_rejected;				///< Rejected connections
+			std::atomic<std::uint64_t> m_shed;					///< Shed requests
+	};
+}
@@ -1,22 +1,166 @@
 #include <StormByte/network/connection/client.hxx>
+#include <StormByte/network/connection/outbox.hxx>
+
+#include <algorithm>
 
 using namespace StormByte::Network::Connection;
 
-Client::Client(std::shared_ptr<Socket::Client> socket, Buffer::Pipeline in_pipeline, Buffer::Pipeline out_pipeline) noexcept:
+Client::Client(std::shared_ptr<Socket::Client> socket, Buffer::Pipeline in_pipeline, Buffer::Pipeline out_pipeline, std::shared_ptr<const Transport::Codec> codec, const std::size_t& max_frame_size, const bool& checksum, const SendQueueOptions& send_queue, std::shared_ptr<Logger::Log> logger) noexcept:
 	m_socket(socket),
 	m_in_pipeline(in_pipeline),
-	m_out_pipeline(out_pipeline)
+	m_in_mutex(),
+	m_out_pipeline(out_pipeline),
+	m_out_mutex(),
+	m_codec(codec),
+	m_max_frame_size(max_frame_size),
+	m_checksum(checksum),
+	m_negotiating(false),
+	m_capabilities(Connection::Capabilities::Legacy()),
+	m_allowed_flags(0),
+	m_outbox(std::make_shared<Outbox>(socket, send_queue, logger)),
+	m_activity(0),
+	m_rtt_last(0),
+	m_rtt_smoothed(0),
+	m_rtt_min(0),
+	m_rtt_samples(0)
 {}
 
+void Client::Negotiated(const Connection::Capabilities& capabilities, std::shared_ptr<const Transport::Codec> codec) noexcept {
+	m_capabilities = capabilities;
+	m_codec = codec;
+
+	m_allowed_flags = 0;
+	if (capabilities.Has(Connection::Feature::FrameFlags)) {
+		m_allowed_flags |= static_cast<std::uint8_t>(Transport::Frame::Flag::Chunked);
+		if (capabilities.Has(Connection::Feature::Compression))
+			m_allowed_flags |= static_cast<std::uint8_t>(Transport::Frame::Flag::Compressed);
+		if (m_checksum && capabilities.Has(Connection::Feature::Checksum))
+			m_allowed_flags |= static_cast<std::uint8_t>(Transport::Frame::Flag::Checksum);
+	}
+}
+
 bool Client::Send(Transport::Frame&& frame, std::shared_ptr<Logger::Log> logger) noexcept {
-	ExpectedVoid result = m_socket->Send(frame.ProcessOutput(m_out_pipeline, logger));
-	if (!result) {
-		logger << Logger::Level::Error << "Failed to send frame to socket: " << result.error()->what();
+	auto data = std::make_shared<Buffer::DataType>();
+	{
+		// Replies may be sent from handler pools while the worker sends too
+		std::scoped_lock lock(m_out_mutex);
+		Buffer::Consumer consumer = frame.ProcessOutput(m_out_pipeline, *m_codec, m_allowed_flags, m_capabilities.features, logger);
+		consumer.ExtractUntilEoF(*data);
+	}
+	if (!FitsPeer(data->size(), logger))
+		return false;
+
+	// Backpressure: a peer that does not read stops this sender instead of growing the queue
+	if (!m_outbox->WaitWritable() || !m_outbox->Push(std::move(data))) {
+		logger << Logger::Level::Error << "Failed to send frame to socket" << std::endl;
+		return false;
+	}
+	return true;
+}
+
+StormByte::Buffer::DataType Client::Encode(Transport::Frame&& frame, std::shared_ptr<Logger::Log> logger) noexcept {
+	// Pipeline copy: the connection's own one may be in use by its worker
+	Buffer::Pipeline pipeline = m_out_pipeline;
+	Buffer::Consumer consumer = frame.ProcessOutput(pipeline, *m_codec, m_allowed_flags, m_capabilities.features, logger);
+	Buffer::DataType data;
+	consumer.ExtractUntilEoF(data);
+	return data;
+}
+
+bool Client::SendEncoded(std::shared_ptr<const Buffer::DataType> frame, const std::string& topic, std::shared_ptr<Logger::Log> logger) noexcept {
+	if (!FitsPeer(frame->size(), logger))
+		return false;
+
+	if (!m_outbox->Offer(std::move(frame), topic)) {
+		logger << Logger::Level::Error << "Failed to send frame to socket" << std::endl;
+		return false;
+	}
+	return true;
+}
+
+bool Client::Writable() const noexcept {
+	return m_outbox->Writable();
+}
+
+bool Client::WhenWritable(std::move_only_function<void()>&& callback) noexcept {
+	return m_outbox->WhenWritable(std::move(callback));
+}
+
+void Client::OnWritabilityChange(std::function<void(bool)> callback) noexcept {
+	m_outbox->OnWritabilityChange(std::move(callback));
+}
+
+std::size_t Client::QueuedBytes() const noexcept {
+	return m_outbox->QueuedBytes();
+}
+
+void Client::SlowConsumers(const SlowConsumerOptions& options) noexcept {
+	m_outbox->Limit(options);
+}
+
+SendStats Client::Stats() const noexcept {
+	return m_outbox->Stats();
+}
+
+bool Client::Overflowed() const noexcept {
+	return m_outbox->Overflowed();
+}
+
+std::size_t Client::Shed() noexcept {
+	return m_outbox->Shed();
+}
+
+void Client::Charge(std::shared_ptr<Budget> budget) noexcept {
+	m_outbox->Charge(std::move(budget));
+}
+
+void Client::SampleRoundTrip(const std::chrono::microseconds& sample) noexcept {
+	// Single writer: plain loads and stores are enough
+	const std::int64_t value = sample.count();
+	const std::uint64_t samples = m_rtt_samples.load(std::memory_order_relaxed);
+	const std::int64_t previous = m_rtt_smoothed.load(std::memory_order_relaxed);
+	const std::int64_t smoothed = samples == 0 ? value : previous + (value - previous) / 8;
+	const std::int64_t min = samples == 0 ? value : std::min(value, m_rtt_min.load(std::memory_order_relaxed));
+	m_rtt_last.store(value, std::memory_order_relaxed);
+	m_rtt_smoothed.store(smoothed, std::memory_order_relaxed);
+	m_rtt_min.store(min, std::memory_order_relaxed);
+	m_rtt_samples.store(samples + 1, std::memory_order_release);
+}
+
+RoundTripStats Client::RoundTrip() const noexcept {
+	RoundTripStats stats;
+	stats.samples = m_rtt_samples.load(std::memory_order_acquire);
+	stats.last = std::chrono::microseconds(m_rtt_last.load(std::memory_order_relaxed));
+	stats.smoothed = std::chrono::microseconds(m_rtt_smoothed.load(std::memory_order_relaxed));
+	stats.min = std::chrono::microseconds(m_rtt_min.load(std::memory_order_relaxed));
+	return stats;
+}
+
+bool Client::EncodesLike(const Client& other, const Transport::Packet::OpcodeType& opcode) const noexcept {
+	return m_allowed_flags == other.m_allowed_flags
+		&& Transport::Frame::IsProcessed(opcode, m_capabilities.features) == Transport::Frame::IsProcessed(opcode, other.m_capabilities.features)
+		&& m_codec->EncodesLike(*other.m_codec, opcode);
+}
+
+bool Client::FitsPeer(const std::size_t& frame_size, std::shared_ptr<Logger::Log> logger) const noexcept {
+	constexpr std::size_t HEADER_SIZE = sizeof(Transport::Packet::OpcodeType) + sizeof(std::size_t);
+	if (m_capabilities.max_frame_size > 0 && frame_size > m_capabilities.max_frame_size + HEADER_SIZE) {
+		logger << Logger::Level::Error << "Frame of " << frame_size - HEADER_SIZE << " bytes exceeds peer limit of "
+				<< m_capabilities.max_frame_size << std::endl;
 		return false;
 	}
 	return true;
 }
 
 StormByte::Network::Transport::Frame Client::Receive(std::shared_ptr<Logger::Log> logger) noexcept {
-	return Transport::Frame::ProcessInput(m_socket, m_in_pipeline, logger);
+	return Transport::Frame::ProcessInput(m_socket, m_in_pipeline, *m_codec, m_capabilities.features, m_max_frame_size, logger);
+}
+
+StormByte::Network::Transport::Frame Client::Read(std::shared_ptr<Logger::Log> logger) noexcept {
+	return Transport::Frame::Read(m_socket, m_capabilities.features, m_max_frame_size, logger);
+}
+
+bool Client::Decode(Transport::Frame& frame, std::shared_ptr<Logger::Log> logger) noexcept {
+	std::scoped_lock lock(m_in_mutex);
+	return frame.Decode(m_in_pipeline, *m_codec, m_max_frame_size, logger);
 }
@@ -20,17 +20,31 @@
 #pragma once
 
 #include <StormByte/buffer/pipeline.hxx>
+#include <StormByte/network/connection/capabilities.hxx>
+#include <StormByte/network/connection/heartbeat.hxx>
+#include <StormByte/network/connection/send_queue_options.hxx>
+#include <StormByte/network/connection/slow_consumer.hxx>
 #include <StormByte/network/socket/client.hxx>
 #include <StormByte/network/transport/frame.hxx>
 
+#include <atomic>
+#include <functional>
+#include <mutex>
+
 /**
  * @namespace Connection
  * @brief Connection helpers (handler, info, client wrapper).
  */
 namespace StormByte::Network::Connection {
+	class Budget;	///< Forward declaration
+	class Outbox;	///< Forward declaration
+
 	/**
 	 * @class Client
 	 * @brief High-level connection over a Socket::Client with I/O pipelines.
+	 *
+	 * Outbound frames go through an Outbox, so they are written without
+	 * blocking and never interleave, whichever thread sends them.
 	 */
 	class STORMBYTE_NETWORK_PRIVATE Client final {
 		public:
@@ -38,8 +52,13 @@ namespace StormByte::Network::Connection {
 			 * @param socket Underlying socket client.
 			 * @param in_pipeline Input pipeline.
 			 * @param out_pipeline Output pipeline.
+			 * @param codec Compression codec (shared by the endpoint's connections).
+			 * @param max_frame_size Largest inbound frame payload (0 = unlimited).
+			 * @param checksum Append CRC32C trailers to outbound frames when the peer verifies them.
+			 * @param send_queue Outbound queue watermarks.
+			 * @param logger Logger for background sends.
 			 */
-			Client(std::shared_ptr<Socket::Client> socket, Buffer::Pipeline in_pipeline, Buffer::Pipeline out_pipeline) noexcept;
+			Client(std::shared_ptr<Socket::Client> socket, Buffer::Pipeline in_pipeline, Buffer::Pipeline out_pipeline, std::shared_ptr<const Transport::Codec> codec, const std::size_t& max_frame_size, const bool& checksum, const SendQueueOptions& send_queue, std::shared_ptr<Logger::Log> logger) noexcept;
 
 			/**
 			 * Copy constructor (deleted).
@@ -47,9 +66,9 @@ namespace StormByte::Network::Connection {
 			Client(const Client& other) = delete;
 
 			/**
-			 * Move constructor.
+			 * Move constructor (deleted).
 			 */
-			Client(Client&& other) noexcept = default;
+			Client(Client&& other) noexcept = delete;
 
 			/**
 			 * Destructor.
@@ -62,9 +81,9 @@ namespace StormByte::Network::Connection {
 			Client& operator=(const Client& other) = delete;
 
 			/**
-			 * Move assignment.
+			 * Move assignment (deleted).
 			 */
-			Client& operator=(Client&& other) noexcept = default;
+			Client& operator=(Client&& other) noexcept = delete;
 
 			/**
 			 * @return Input pipeline.
@@ -88,20 +107,154 @@ namespace StormByte::Network::Connection {
 			}
 
 			/**
-			 * Sends a frame (moves payload through the output pipeline).
+			 * Sends a frame (moves payload through the output pipeline), first
+			 * waiting while the connection is not @ref Writable().
 			 * @param frame Frame to send (use std::move).
 			 * @param logger Logger.
-			 * @return true on success.
+			 * @return true once sent or queued.
 			 */
 			bool Send(Transport::Frame&& frame, std::shared_ptr<Logger::Log> logger) noexcept;
 
 			/**
-			 * @return Connection status from the socket (or Disconnected).
+			 * Runs @p frame through a copy of the output pipeline and this
+			 * connection's codec and flags, without sending it.
+			 * @param frame Frame to encode (use std::move).
+			 * @param logger Logger.
+			 * @return On-wire bytes, valid for every connection that @ref EncodesLike() this one.
+			 */
+			Buffer::DataType Encode(Transport::Frame&& frame, std::shared_ptr<Logger::Log> logger) noexcept;
+
+			/**
+			 * Sends bytes produced by @ref Encode() without copying them, as a
+			 * fan-out frame subject to the slow consumer policy. Never waits:
+			 * callers fanning out should check @ref Writable() first.
+			 * @param frame On-wire frame bytes.
+			 * @param topic Conflation key (empty: never conflated).
+			 * @param logger Logger.
+			 * @return true once sent or queued.
+			 */
+			bool SendEncoded(std::shared_ptr<const Buffer::DataType> frame, const std::string& topic, std::shared_ptr<Logger::Log> logger) noexcept;
+
+			/**
+			 * @return true unless the outbound queue is over its high watermark
+			 * (until it drains to the low one) or the socket failed.
+			 */
+			bool Writable() const noexcept;
+
+			/**
+			 * Runs @p callback once the connection is writable again (now if it
+			 * is). A pending callback also runs if the socket fails.
+			 * @param callback One-shot callback.
+			 * @return false (and @p callback is dropped) if the socket already failed.
+			 */
+			bool WhenWritable(std::move_only_function<void()>&& callback) noexcept;
+
+			/**
+			 * Sets the writability transition callback (nullptr to clear).
+			 * @param callback Called with the new state.
+			 */
+			void OnWritabilityChange(std::function<void(bool)> callback) noexcept;
+
+			/**
+			 * @return Outbound bytes not written to the socket yet.
+			 */
+			std::size_t QueuedBytes() const noexcept;
+
+			/**
+			 * Sets the slow consumer limits of the outbound queue (default: none).
+			 * @param options Limits.
+			 */
+			void SlowConsumers(const SlowConsumerOptions& options) noexcept;
+
+			/**
+			 * @return Send-progress counters.
+			 */
+			SendStats Stats() const noexcept;
+
+			/**
+			 * @return true once a fan-out frame was refused under SlowConsumerPolicy::Disconnect.
+			 */
+			bool Overflowed() const noexcept;
+
+			/**
+			 * Drops every unsent fan-out frame.
+			 * @return Number of frames dropped.
+			 */
+			std::size_t Shed() noexcept;
+
+			/**
+			 * Counts queued outbound bytes against @p budget.
+			 * @param budget Server admission budget.
+			 */
+			void Charge(std::shared_ptr<Budget> budget) noexcept;
+
+			/**
+			 * @param other Another connection of the same endpoint.
+			 * @param opcode Opcode of the frame to encode.
+			 * @return true if frames with @p opcode encode to the same bytes for both.
+			 */
+			bool EncodesLike(const Client& other, const Transport::Packet::OpcodeType& opcode) const noexcept;
+
+			/**
+			 * @return Connection status from the socket (or Disconnected);
+			 * Negotiating while a handshake is in progress.
 			 */
 			inline Connection::Status Status() const noexcept {
-				return m_socket ? m_socket->Status() : Connection::Status::Disconnected;
+				if (!m_socket)
+					return Connection::Status::Disconnected;
+				const Connection::Status status = m_socket->Status();
+				return status == Connection::Status::Connected && m_negotiating.load(std::memory_order_acquire)
+					? Connection::Status::Negotiating : status;
+			}
+
+			/**
+			 * Marks the handshake as started / finished.
+			 * @param negotiating true while negotiating.
+			 */
+			inline void Negotiating(const bool& negotiating) noexcept {
+				m_negotiating.store(negotiating, std::memory_order_release);
+			}
+
+			/**
+			 * Records activity (a frame received) for idle detection.
+			 * @param tick Executor::TimerWheel::Now() reading.
+			 */
+			inline void Touch(const std::uint64_t& tick) noexcept {
+				m_activity.store(tick, std::memory_order_relaxed);
+			}
+
+			/**
+			 * @return Tick of the last @ref Touch().
+			 */
+			inline std::uint64_t LastActivity() const noexcept {
+				return m_activity.load(std::memory_order_relaxed);
 			}
 
+			/**
+			 * Records a heartbeat round trip (from the reading thread only).
+			 * @param sample Measured round-trip time.
+			 */
+			void SampleRoundTrip(const std::chrono::microseconds& sample) noexcept;
+
+			/**
+			 * @return Round-trip times measured so far (safe from any thread).
+			 */
+			Connection::RoundTripStats RoundTrip() const noexcept;
+
+			/**
+			 * @return Capabilities usable when sending to the peer.
+			 */
+			inline const Connection::Capabilities& Capabilities() const noexcept {
+				return m_capabilities;
+			}
+
+			/**
+			 * Applies negotiated capabilities (call before concurrent use).
+			 * @param capabilities Result of Capabilities::Intersect() (or Legacy()).
+			 * @param codec Codec restricted to what the peer decodes.
+			 */
+			void Negotiated(const Connection::Capabilities& capabilities, std::shared_ptr<const Transport::Codec> codec) noexcept;
+
 			/**
 			 * Receives one framed message.
 			 * @param logger Logger.
@@ -109,9 +262,48 @@ namespace StormByte::Network::Connection {
 			 */
 			Transport::Frame Receive(std::shared_ptr<Logger::Log> logger) noexcept;
 
+			/**
+			 * Receives one framed message without decoding it, see
+			 * Transport::Frame::Read().
+			 * @param logger Logger.
+			 * @return Frame (empty on failure).
+			 */
+			Transport::Frame Read(std::shared_ptr<Logger::Log> logger) noexcept;
+
+			/**
+			 * Decodes a frame from @ref Read() with the input pipeline and
+			 * codec. Safe to call from any thread.
+			 * @param frame Frame (decoded in place).
+			 * @param logger Logger.
+			 * @return false if the payload could not be decoded.
+			 */
+			bool Decode(Transport::Frame& frame, std::shared_ptr<Logger::Log> logger) noexcept;
+
 		private:
 			std::shared_ptr<Socket::Client> m_socket;	///< Socket
 			Buffer::Pipeline m_in_pipeline;				///< Input pipeline
+			std::mutex m_in_mutex;						///< Serializes m_in_pipeline use in Decode()
 			Buffer::Pipeline m_out_pipeline;			///< Output pipeline
+			std::mutex m_out_mutex;						///< Serializes m_out_pipeline use in Send()
+			std::shared_ptr<const Transport::Codec> m_codec;	///< Compression codec
+			std::size_t m_max_frame_size;				///< Inbound payload limit (0 = unlimited)
+			bool m_checksum;							///< Outbound frame checksums requested
+			std::atomic<bool> m_negotiating;			///< Handshake in progress
+			Connection::Capabilities m_capabilities;	///< Negotiated capabilities
+			std::uint8_t m_allowed_flags;				///< Frame flags the peer understands
+			std::shared_ptr<Outbox> m_outbox;			///< Outbound queue
+			std::atomic<std::uint64_t> m_activity;		///< Wheel tick of the last received frame
+			std::atomic<std::int64_t> m_rtt_last;		///< Latest round trip (us)
+			std::atomic<std::int64_t> m_rtt_smoothed;	///< Smoothed round trip (us)
+			std::atomic<std::int64_t> m_rtt_min;		///< Smallest round trip (us)
+			std::atomic<std::uint64_t> m_rtt_samples;	///< Round-trip samples
+
+			/**
+			 * Checks the peer's frame size limit.
+			 * @param frame_size Encoded frame size (header included).
+			 * @param logger Logger.
+			 * @return true if the peer accepts the frame.
+			 */
+			bool FitsPeer(const std::size_t& frame_size, std::shared_ptr<Logger::Log> logger) const noexcept;
 	};
 }
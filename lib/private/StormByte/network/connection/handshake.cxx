@@ -0,0 +1,85 @@
+#include <StormByte/network/connection/handshake.hxx>
+#include <StormByte/serializable.hxx>
+
+#include <optional>
+
+using StormByte::Buffer::DataType;
+using StormByte::Network::ConnectionError;
+using namespace StormByte::Network::Connection;
+
+namespace {
+	template <typename T>
+	void Append(DataType& out, const T& value) noexcept {
+		const DataType bytes = StormByte::Serializable<T>(value).Serialize();
+		out.insert(out.end(), bytes.begin(), bytes.end());
+	}
+
+	/**
+	 * Reads a serialized T at @p offset and advances it.
+	 * @return Value, or std::nullopt if @p data is too short.
+	 */
+	template <typename T>
+	std::optional<T> Take(const DataType& data, std::size_t& offset) noexcept {
+		if (offset > data.size() || data.size() - offset < sizeof(T))
+			return std::nullopt;
+		auto expected = StormByte::Serializable<T>::Deserialize(DataType(data.begin() + offset, data.begin() + offset + sizeof(T)));
+		if (!expected)
+			return std::nullopt;
+		offset += sizeof(T);
+		return expected.value();
+	}
+}
+
+bool Handshake::IsHandshake(const DataType& payload) noexcept {
+	std::size_t offset = 0;
+	const auto magic = Take<std::uint32_t>(payload, offset);
+	return magic && *magic == MAGIC;
+}
+
+DataType Handshake::Serialize(const Capabilities& capabilities) noexcept {
+	DataType payload;
+	Append<std::uint32_t>(payload, MAGIC);
+	Append<std::uint16_t>(payload, capabilities.version);
+	Append<std::uint32_t>(payload, capabilities.features);
+	Append<std::size_t>(payload, capabilities.max_frame_size);
+	Append<std::uint8_t>(payload, capabilities.compression);
+	Append<std::size_t>(payload, capabilities.dictionaries.size());
+	for (const auto& [opcode, id] : capabilities.dictionaries) {
+		Append<Transport::Packet::OpcodeType>(payload, opcode);
+		Append<std::uint32_t>(payload, id);
+	}
+	return payload;
+}
+
+StormByte::Expected<Capabilities, ConnectionError> Handshake::Deserialize(const DataType& payload) noexcept {
+	std::size_t offset = 0;
+	const auto magic = Take<std::uint32_t>(payload, offset);
+	if (!magic || *magic != MAGIC)
+		return Unexpected<ConnectionError>("Malformed handshake: missing magic");
+
+	const auto version = Take<std::uint16_t>(payload, offset);
+	const auto features = Take<std::uint32_t>(payload, offset);
+	const auto max_frame_size = Take<std::size_t>(payload, offset);
+	const auto compression = Take<std::uint8_t>(payload, offset);
+	const auto dictionary_count = Take<std::size_t>(payload, offset);
+	if (!version || !features || !max_frame_size || !compression || !dictionary_count)
+		return Unexpected<ConnectionError>("Malformed handshake: truncated header");
+
+	constexpr std::size_t ENTRY_SIZE = sizeof(Transport::Packet::OpcodeType) + sizeof(std::uint32_t);
+	if (*dictionary_count > (payload.size() - offset) / ENTRY_SIZE)
+		return Unexpected<ConnectionError>("Malformed handshake: {} dictionaries announced", *dictionary_count);
+
+	Capabilities capabilities;
+	capabilities.version = *version;
+	capabilities.features = *features;
+	capabilities.max_frame_size = *max_frame_size;
+	capabilities.compression = *compression;
+	for (std::size_t i = 0; i < *dictionary_count; ++i) {
+		const auto opcode = Take<Transport::Packet::OpcodeType>(payload, offset);
+		const auto id = Take<std::uint32_t>(payload, offset);
+		if (!opcode || !id)
+			return Unexpected<ConnectionError>("Malformed handshake: truncated dictionary list");
+		capabilities.dictionaries.emplace(*opcode, *id);
+	}
+	return capabilities;
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <StormByte/expected.hxx>
+#include <StormByte/network/connection/capabilities.hxx>
+#include <StormByte/network/exception.hxx>
+
+/**
+ * @namespace Handshake
+ * @brief Wire encoding of the capability handshake.
+ *
+ * Layout: @ref MAGIC (u32), version (u16), features (u32), max frame size
+ * (size_t), compression mask (u8), dictionary count (size_t), then
+ * (opcode, dictionary ID) pairs. Trailing bytes are ignored so later
+ * versions can append fields.
+ *
+ * Control::Hello shares opcode 1 with applications predating the
+ * handshake, so only a payload starting with @ref MAGIC is a handshake.
+ */
+namespace StormByte::Network::Connection::Handshake {
+	constexpr std::uint32_t MAGIC = 0x53424853;	///< Leading handshake bytes ("SBHS")
+
+	/**
+	 * @param payload Payload of a frame with the Control::Hello opcode.
+	 * @return true if @p payload starts with @ref MAGIC.
+	 */
+	STORMBYTE_NETWORK_PRIVATE bool IsHandshake(const Buffer::DataType& payload) noexcept;
+
+	/**
+	 * @param capabilities Capabilities to encode.
+	 * @return Handshake payload.
+	 */
+	STORMBYTE_NETWORK_PRIVATE Buffer::DataType Serialize(const Capabilities& capabilities) noexcept;
+
+	/**
+	 * @param payload Handshake payload.
+	 * @return Capabilities or ConnectionError if @p payload is malformed.
+	 */
+	STORMBYTE_NETWORK_PRIVATE Expected<Capabilities, ConnectionError> Deserialize(const Buffer::DataType& payload) noexcept;
+}
@@ -13,6 +13,7 @@
 #endif
 
 #include <StormByte/network/connection/handler.hxx>
+#include <StormByte/network/connection/resolver.hxx>
 
 using namespace StormByte::Network::Connection;
 using StormByte::Network::Exception;
@@ -23,55 +24,40 @@ Info::Info(std::shared_ptr<sockaddr> sock_addr) noexcept:
 }
 
 StormByte::Expected<Info, Exception> Info::FromHost(const std::string& hostname, const unsigned short& port, const Protocol& protocol) noexcept {
-	auto expected_sock_addr = Info::ResolveHostname(hostname, port, protocol);
-	if (!expected_sock_addr)
-		return Unexpected(expected_sock_addr.error());
+	auto expected_infos = Info::Resolve(hostname, port, protocol);
+	if (!expected_infos)
+		return Unexpected(expected_infos.error());
 
-	return Info(std::move(expected_sock_addr.value()));
+	return std::move(expected_infos.value().front());
 }
 
-StormByte::Expected<Info, Exception> Info::FromSockAddr(std::shared_ptr<sockaddr> sockaddr) noexcept {
-	if (!sockaddr)
-		return Unexpected<Exception>("Invalid socket address");
-
-	return Info(sockaddr);
-}
-
-StormByte::Expected<std::shared_ptr<sockaddr>, Exception> Info::ResolveHostname(const std::string& hostname, const unsigned short& port, const Protocol& protocol) noexcept {
-	struct addrinfo hints{}, *res = nullptr;
-
-	hints.ai_family = ProtocolInt(protocol);
-	hints.ai_socktype = SOCK_STREAM;
-
-	int ret = getaddrinfo(hostname.c_str(), nullptr, &hints, &res);
-	if (ret != 0 || !res)
-		return Unexpected<Exception>("Can't resolve host '{}': {}", hostname, Handler::Instance().LastError());
-
-	std::unique_ptr<addrinfo, decltype(&freeaddrinfo)> res_guard(res, freeaddrinfo);
-
-	char ipstr[INET6_ADDRSTRLEN];
-	void* addr = nullptr;
-
-	if (res->ai_family == AF_INET) {
-		addr = &((struct sockaddr_in*)res->ai_addr)->sin_addr;
-	} else if (res->ai_family == AF_INET6) {
-		addr = &((struct sockaddr_in6*)res->ai_addr)->sin6_addr;
-	}
-	if (!addr)
-		return Unexpected<Exception>("Unable to determine resolved address");
-
-	inet_ntop(res->ai_family, addr, ipstr, sizeof(ipstr));
-
-	sockaddr_in resolved{};
-	resolved.sin_family = ProtocolInt(protocol);
-	resolved.sin_port = htons(port);
-
-	if (inet_pton(resolved.sin_family, ipstr, &resolved.sin_addr) <= 0) {
-		return Unexpected<Exception>("Invalid IP address '{}'", ipstr);
+StormByte::Expected<std::vector<Info>, Exception> Info::Resolve(const std::string& hostname, const unsigned short& port, const Protocol& protocol, const std::chrono::steady_clock::time_point& deadline) noexcept {
+	std::shared_future<Resolver::AnswerPointer> lookup = Resolver::Instance().Lookup(hostname, protocol);
+	// The lookup keeps running for later callers; only this wait is bounded
+	if (deadline != std::chrono::steady_clock::time_point::max() && lookup.wait_until(deadline) != std::future_status::ready)
+		return Unexpected<Exception>("Timed out resolving host '{}'", hostname);
+
+	const Resolver::AnswerPointer answer = lookup.get();
+	if (answer->addresses.empty())
+		return Unexpected<Exception>("Can't resolve host '{}': {}", hostname, answer->error);
+
+	std::vector<Info> infos;
+	infos.reserve(answer->addresses.size());
+	for (const sockaddr_storage& address: answer->addresses) {
+		// sockaddr_storage fits either family; the sockaddr view aliases it
+		auto storage = std::make_shared<sockaddr_storage>(address);
+		if (storage->ss_family == AF_INET)
+			reinterpret_cast<sockaddr_in*>(storage.get())->sin_port = htons(port);
+		else
+			reinterpret_cast<sockaddr_in6*>(storage.get())->sin6_port = htons(port);
+
+		infos.push_back(Info(std::shared_ptr<sockaddr>(storage, reinterpret_cast<sockaddr*>(storage.get()))));
 	}
+	return infos;
+}
 
-	auto resolved_sock = std::make_unique<sockaddr_in>(resolved);
-	return std::shared_ptr<sockaddr>(reinterpret_cast<sockaddr*>(resolved_sock.release()));
+socklen_t Info::SockAddrSize() const noexcept {
+	return m_sock_addr->sa_family == AF_INET6 ? sizeof(sockaddr_in6) : sizeof(sockaddr_in);
 }
 
 void Info::Initialize(std::shared_ptr<sockaddr> sock_addr) noexcept {
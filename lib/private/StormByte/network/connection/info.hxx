@@ -25,12 +25,15 @@
 
 #ifdef WINDOWS
 #include <winsock2.h>
+#include <ws2tcpip.h>
 #else
 #include <sys/socket.h>
 #endif
 
+#include <chrono>
 #include <memory>
 #include <string>
+#include <vector>
 
 /**
  * @namespace Connection
@@ -79,6 +82,16 @@ namespace StormByte::Network::Connection {
 			 */
 			static StormByte::Expected<Info, Exception> FromHost(const std::string& hostname, const unsigned short& port, const Protocol& protocol) noexcept;
 
+			/**
+			 * Resolves hostname to every address it has.
+			 * @param hostname Host name.
+			 * @param port Port.
+			 * @param protocol Address family (Protocol::Any for both).
+			 * @param deadline Give up waiting for the resolver after this point (max = never).
+			 * @return Addresses in resolver order (never empty) or error.
+			 */
+			static StormByte::Expected<std::vector<Info>, Exception> Resolve(const std::string& hostname, const unsigned short& port, const Protocol& protocol, const std::chrono::steady_clock::time_point& deadline = std::chrono::steady_clock::time_point::max()) noexcept;
+
 			/**
 			 * Builds Info from an existing sockaddr.
 			 * @param sockaddr Socket address.
@@ -107,6 +120,19 @@ namespace StormByte::Network::Connection {
 				return m_sock_addr;
 			}
 
+			/**
+			 * @return Length of the address behind @ref SockAddr(), as bind()
+			 * and connect() expect it.
+			 */
+			socklen_t SockAddrSize() const noexcept;
+
+			/**
+			 * @return Address family.
+			 */
+			inline Protocol Family() const noexcept {
+				return static_cast<Protocol>(m_sock_addr->sa_family);
+			}
+
 		private:
 			std::shared_ptr<sockaddr> m_sock_addr;	///< Socket address
 			unsigned int m_mtu;						///< MTU (reserved)
@@ -118,15 +144,6 @@ namespace StormByte::Network::Connection {
 			 */
 			Info(std::shared_ptr<sockaddr> sock_addr) noexcept;
 
-			/**
-			 * Hostname resolution helper.
-			 * @param hostname Host name.
-			 * @param port Port.
-			 * @param protocol Address family.
-			 * @return Shared sockaddr or error.
-			 */
-			static StormByte::Expected<std::shared_ptr<sockaddr>, Exception> ResolveHostname(const std::string& hostname, const unsigned short& port, const Protocol& protocol) noexcept;
-
 			/**
 			 * Fills IP/port from sockaddr.
 			 * @param sock_addr Socket address.
@@ -0,0 +1,300 @@
+#include <StormByte/network/connection/budget.hxx>
+#include <StormByte/network/connection/outbox.hxx>
+#include <StormByte/network/executor/write_poller.hxx>
+#include <StormByte/network/socket/client.hxx>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+using namespace StormByte::Network::Connection;
+
+Outbox::Outbox(std::shared_ptr<Socket::Client> socket, const SendQueueOptions& options, std::shared_ptr<Logger::Log> logger) noexcept:
+	m_socket(socket),
+	m_options { .high_watermark = std::max<std::size_t>(1, options.high_watermark), .low_watermark = std::min(options.low_watermark, std::max<std::size_t>(1, options.high_watermark)) },
+	m_logger(logger),
+	m_queue(),
+	m_bytes(0),
+	m_flushing(false),
+	m_paused(false),
+	m_failed(false),
+	m_limits { .policy = SlowConsumerPolicy::Disconnect, .max_queued_bytes = 0, .max_stall = 0 },
+	m_last_progress(Clock::now()),
+	m_sent(0),
+	m_dropped(0),
+	m_overflowed(false),
+	m_budget(nullptr),
+	m_charged(0) {}
+
+Outbox::~Outbox() noexcept {
+	if (m_budget)
+		m_budget->Buffered(0, m_charged);
+}
+
+bool Outbox::Push(std::shared_ptr<const Buffer::DataType> data) noexcept {
+	std::unique_lock lock(m_mutex);
+	return Enqueue(lock, std::move(data), {}, false);
+}
+
+bool Outbox::Offer(std::shared_ptr<const Buffer::DataType> data, const std::string& key) noexcept {
+	std::unique_lock lock(m_mutex);
+	if (m_failed || m_overflowed)
+		return false;
+
+	if (m_limits.policy == SlowConsumerPolicy::Conflate && !key.empty()) {
+		// Untouched segments only: a partly written frame must be finished
+		auto queued = std::find_if(m_queue.begin(), m_queue.end(), [&key](const Segment& segment) {
+			return segment.droppable && segment.offset == 0 && segment.key == key;
+		});
+		if (queued != m_queue.end()) {
+			m_bytes = m_bytes - queued->data->size() + data->size();
+			queued->data = std::move(data);
+			++m_dropped;
+			Settle(lock);
+			return true;
+		}
+	}
+
+	if (m_limits.max_queued_bytes > 0 && m_bytes + data->size() > m_limits.max_queued_bytes) {
+		if (m_limits.policy == SlowConsumerPolicy::Disconnect) {
+			m_logger << Logger::Level::Warning << "Send queue of " << m_bytes << " bytes is over its limit of "
+					<< m_limits.max_queued_bytes << " bytes; refusing fan-out frames" << std::endl;
+			m_overflowed = true;
+			++m_dropped;
+			return false;
+		}
+		// The newest frame is always kept, even if it alone is over the limit
+		DropOldest(data->size());
+	}
+
+	return Enqueue(lock, std::move(data), key, true);
+}
+
+bool Outbox::WaitWritable() noexcept {
+	std::unique_lock lock(m_mutex);
+	while (m_paused && !m_failed) {
+		if (m_limits.max_stall == 0) {
+			m_writable_cv.wait(lock);
+			continue;
+		}
+
+		// Progress moves the deadline, so only a queue that stopped draining times out
+		const Clock::time_point deadline = m_last_progress + std::chrono::milliseconds(m_limits.max_stall);
+		if (Clock::now() >= deadline) {
+			m_logger << Logger::Level::Warning << "Send queue made no progress for " << m_limits.max_stall
+					<< " ms; giving up on " << m_bytes << " queued bytes" << std::endl;
+			return false;
+		}
+		m_writable_cv.wait_until(lock, deadline);
+	}
+	return !m_failed;
+}
+
+bool Outbox::Writable() const noexcept {
+	std::scoped_lock lock(m_mutex);
+	return !m_paused && !m_failed;
+}
+
+bool Outbox::WhenWritable(std::move_only_function<void()>&& callback) noexcept {
+	{
+		std::scoped_lock lock(m_mutex);
+		if (m_failed)
+			return false;
+		if (m_paused) {
+			m_when_writable.push_back(std::move(callback));
+			return true;
+		}
+	}
+	callback();
+	return true;
+}
+
+void Outbox::OnWritabilityChange(std::function<void(bool)> callback) noexcept {
+	std::scoped_lock lock(m_change_mutex);
+	m_on_change = std::move(callback);
+}
+
+std::size_t Outbox::QueuedBytes() const noexcept {
+	std::scoped_lock lock(m_mutex);
+	return m_bytes;
+}
+
+void Outbox::Limit(const SlowConsumerOptions& options) noexcept {
+	std::scoped_lock lock(m_mutex);
+	m_limits = options;
+	m_writable_cv.notify_all();
+}
+
+SendStats Outbox::Stats() const noexcept {
+	std::scoped_lock lock(m_mutex);
+	return SendStats {
+		.queued_bytes = m_bytes,
+		.queued_frames = m_queue.size(),
+		.stalled = m_queue.empty() ? std::chrono::milliseconds::zero()
+			: std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - m_last_progress),
+		.sent_bytes = m_sent,
+		.dropped_frames = m_dropped,
+		.writable = !m_paused && !m_failed,
+	};
+}
+
+bool Outbox::Overflowed() const noexcept {
+	std::scoped_lock lock(m_mutex);
+	return m_overflowed;
+}
+
+std::size_t Outbox::Shed() noexcept {
+	std::unique_lock lock(m_mutex);
+	const std::size_t dropped = DropOldest(std::numeric_limits<std::size_t>::max());
+	if (dropped > 0)
+		m_last_progress = Clock::now();
+	Settle(lock);
+	return dropped;
+}
+
+void Outbox::Charge(std::shared_ptr<Budget> budget) noexcept {
+	std::scoped_lock lock(m_mutex);
+	if (m_budget)
+		m_budget->Buffered(0, m_charged);
+	m_budget = std::move(budget);
+	m_charged = 0;
+	Recount();
+}
+
+bool Outbox::Enqueue(std::unique_lock<std::mutex>& lock, std::shared_ptr<const Buffer::DataType> data, const std::string& key, const bool& droppable) noexcept {
+	if (m_failed)
+		return false;
+
+	std::size_t offset = 0;
+	if (!m_flushing && m_queue.empty()) {
+		// Optimistic path: nothing queued, so write right away
+		auto expected_sent = m_socket->TrySend(std::span<const std::byte>(data->data(), data->size()));
+		if (!expected_sent) {
+			auto callbacks = Fail();
+			Recount();
+			lock.unlock();
+			for (auto& callback : callbacks)
+				callback();
+			return false;
+		}
+		offset = expected_sent.value();
+		m_sent += offset;
+		if (offset == data->size())
+			return true;
+	}
+
+	// The stall clock starts when something has to wait
+	if (m_queue.empty())
+		m_last_progress = Clock::now();
+	m_bytes += data->size() - offset;
+	m_queue.push_back(Segment { .data = std::move(data), .offset = offset, .key = key, .droppable = droppable });
+	const bool arm = !std::exchange(m_flushing, true);
+	Settle(lock);
+
+	if (arm)
+		Arm();
+	return true;
+}
+
+std::size_t Outbox::DropOldest(const std::size_t& incoming) noexcept {
+	const auto fits = [this, &incoming] {
+		return incoming != std::numeric_limits<std::size_t>::max() && m_bytes + incoming <= m_limits.max_queued_bytes;
+	};
+
+	std::size_t dropped = 0;
+	for (auto segment = m_queue.begin(); segment != m_queue.end() && !fits();) {
+		if (segment->droppable && segment->offset == 0) {
+			m_bytes -= segment->data->size();
+			segment = m_queue.erase(segment);
+			++dropped;
+		}
+		else
+			++segment;
+	}
+	m_dropped += dropped;
+	return dropped;
+}
+
+void Outbox::Recount() noexcept {
+	if (m_budget && m_charged != m_bytes) {
+		m_budget->Buffered(m_bytes, m_charged);
+		m_charged = m_bytes;
+	}
+}
+
+void Outbox::Settle(std::unique_lock<std::mutex>& lock) noexcept {
+	Recount();
+	std::vector<std::move_only_function<void()>> callbacks;
+	bool paused = false, resumed = false;
+	if (!m_failed && !m_paused && m_bytes >= m_options.high_watermark) {
+		m_paused = paused = true;
+	}
+	else if (!m_failed && m_paused && m_bytes <= m_options.low_watermark) {
+		m_paused = false;
+		resumed = true;
+		callbacks = std::exchange(m_when_writable, {});
+		m_writable_cv.notify_all();
+	}
+	lock.unlock();
+
+	if (paused || resumed)
+		NotifyChange(resumed);
+	for (auto& callback : callbacks)
+		callback();
+}
+
+void Outbox::Arm() noexcept {
+	Executor::WritePoller::Instance().Watch(m_socket->Handle(), [self = shared_from_this()] {
+		self->Flush();
+	});
+}
+
+void Outbox::Flush() noexcept {
+	std::vector<std::move_only_function<void()>> callbacks;
+	bool rearm = false;
+	std::unique_lock lock(m_mutex);
+	while (!m_queue.empty()) {
+		Segment& front = m_queue.front();
+		auto expected_sent = m_socket->TrySend(std::span<const std::byte>(front.data->data() + front.offset, front.data->size() - front.offset));
+		if (!expected_sent) {
+			m_logger << Logger::Level::Error << "Dropping " << m_bytes << " queued bytes: " << expected_sent.error()->what() << std::endl;
+			callbacks = Fail();
+			break;
+		}
+
+		front.offset += expected_sent.value();
+		m_bytes -= expected_sent.value();
+		m_sent += expected_sent.value();
+		if (expected_sent.value() > 0)
+			m_last_progress = Clock::now();
+		if (front.offset == front.data->size())
+			m_queue.pop_front();
+		else if (expected_sent.value() == 0) {
+			rearm = true;
+			break;
+		}
+	}
+	if (!rearm)
+		m_flushing = false;
+	Settle(lock);
+
+	if (rearm)
+		Arm();
+	for (auto& callback : callbacks)
+		callback();
+}
+
+std::vector<std::move_only_function<void()>> Outbox::Fail() noexcept {
+	m_failed = true;
+	m_queue.clear();
+	m_bytes = 0;
+	m_flushing = false;
+	m_writable_cv.notify_all();
+	return std::exchange(m_when_writable, {});
+}
+
+void Outbox::NotifyChange(const bool& writable) noexcept {
+	std::scoped_lock lock(m_change_mutex);
+	if (m_on_change)
+		m_on_change(writable);
+}
@@ -0,0 +1,262 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <StormByte/network/connection/send_queue_options.hxx>
+#include <StormByte/network/connection/slow_consumer.hxx>
+#include <StormByte/network/typedefs.hxx>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @namespace Connection
+ * @brief Connection helpers (handler, info, client wrapper).
+ */
+namespace StormByte::Network::Connection {
+	/**
+	 * @class Outbox
+	 * @brief Outbound byte queue of one connection.
+	 *
+	 * @ref Push() writes straight to the socket while the queue is empty and
+	 * queues whatever the kernel does not take. Queued bytes are written by
+	 * Executor::Pool tasks each time Executor::WritePoller reports the socket
+	 * writable, so no thread blocks on a slow peer. Buffers are shared, never
+	 * copied, so one encoded frame can sit in many outboxes.
+	 *
+	 * Crossing SendQueueOptions::high_watermark makes the outbox not
+	 * writable until it drains to SendQueueOptions::low_watermark; the
+	 * transitions are reported to the @ref OnWritabilityChange() callback.
+	 *
+	 * Fan-out frames (@ref Offer()) are subject to the SlowConsumerOptions
+	 * set with @ref Limit(); replies (@ref Push()) are never dropped.
+	 * Non-copyable / non-movable; always owned by a std::shared_ptr.
+	 */
+	class Budget;	///< Forward declaration
+
+	class STORMBYTE_NETWORK_PRIVATE Outbox final: public std::enable_shared_from_this<Outbox> {
+		public:
+			/**
+			 * @param socket Connection socket.
+			 * @param options Watermarks.
+			 * @param logger Logger.
+			 */
+			Outbox(std::shared_ptr<Socket::Client> socket, const SendQueueOptions& options, std::shared_ptr<Logger::Log> logger) noexcept;
+
+			/**
+			 * Copy constructor (deleted).
+			 */
+			Outbox(const Outbox& other) = delete;
+
+			/**
+			 * Move constructor (deleted).
+			 */
+			Outbox(Outbox&& other) noexcept = delete;
+
+			/**
+			 * Destructor (returns queued bytes to the @ref Charge() budget).
+			 */
+			~Outbox() noexcept;
+
+			/**
+			 * Copy assignment (deleted).
+			 */
+			Outbox& operator=(const Outbox& other) = delete;
+
+			/**
+			 * Move assignment (deleted).
+			 */
+			Outbox& operator=(Outbox&& other) noexcept = delete;
+
+			/**
+			 * Sends or queues @p data (whole, never interleaved with other pushes).
+			 * @param data Bytes to send.
+			 * @return false if the socket failed (now or earlier).
+			 */
+			bool Push(std::shared_ptr<const Buffer::DataType> data) noexcept;
+
+			/**
+			 * Sends or queues a fan-out frame, applying the slow consumer policy:
+			 * under Conflate it replaces an unsent frame with the same @p key,
+			 * and over SlowConsumerOptions::max_queued_bytes it drops the oldest
+			 * unsent fan-out frames (or, under Disconnect, marks the outbox
+			 * @ref Overflowed() and refuses the frame).
+			 * @param data Bytes to send.
+			 * @param key Conflation key (topic); empty frames never conflate.
+			 * @return false if the socket failed or the frame was refused.
+			 */
+			bool Offer(std::shared_ptr<const Buffer::DataType> data, const std::string& key) noexcept;
+
+			/**
+			 * Blocks while the outbox is not writable, at most until the queue
+			 * has made no progress for SlowConsumerOptions::max_stall.
+			 * @return false if the socket failed or the queue stalled.
+			 */
+			bool WaitWritable() noexcept;
+
+			/**
+			 * @return true below the high watermark (or since draining to the low one).
+			 */
+			bool Writable() const noexcept;
+
+			/**
+			 * Runs @p callback once the outbox is writable (immediately if it is).
+			 * Pending callbacks also run when the socket fails, so they must check it.
+			 * @param callback One-shot callback.
+			 * @return false (and @p callback is dropped) if the socket already failed.
+			 */
+			bool WhenWritable(std::move_only_function<void()>&& callback) noexcept;
+
+			/**
+			 * Sets the writability transition callback (nullptr to clear). Once
+			 * this returns, a previous callback is no longer running.
+			 * @param callback Called with false on crossing the high watermark
+			 * and true on draining to the low one. Must not call back into
+			 * this outbox's setters.
+			 */
+			void OnWritabilityChange(std::function<void(bool)> callback) noexcept;
+
+			/**
+			 * @return Bytes waiting to be written.
+			 */
+			std::size_t QueuedBytes() const noexcept;
+
+			/**
+			 * Sets the slow consumer limits (default: no limits).
+			 * @param options Limits.
+			 */
+			void Limit(const SlowConsumerOptions& options) noexcept;
+
+			/**
+			 * @return Send-progress counters.
+			 */
+			SendStats Stats() const noexcept;
+
+			/**
+			 * @return true once a fan-out frame was refused under the Disconnect policy.
+			 */
+			bool Overflowed() const noexcept;
+
+			/**
+			 * Drops every unsent fan-out frame and restarts the stall clock if
+			 * any was dropped.
+			 * @return Number of frames dropped.
+			 */
+			std::size_t Shed() noexcept;
+
+			/**
+			 * Counts queued bytes against @p budget from now on.
+			 * @param budget Server admission budget.
+			 */
+			void Charge(std::shared_ptr<Budget> budget) noexcept;
+
+		private:
+			using Clock = std::chrono::steady_clock;	///< Stall clock
+
+			/**
+			 * @struct Segment
+			 * @brief Queued buffer and how much of it was already written.
+			 */
+			struct Segment {
+				std::shared_ptr<const Buffer::DataType> data;	///< Shared bytes
+				std::size_t offset;								///< Bytes already written
+				std::string key;								///< Conflation key
+				bool droppable;									///< Fan-out frame
+			};
+
+			std::shared_ptr<Socket::Client> m_socket;						///< Connection socket
+			const SendQueueOptions m_options;								///< Watermarks
+			std::shared_ptr<Logger::Log> m_logger;							///< Logger
+			mutable std::mutex m_mutex;										///< Protects the state below
+			std::condition_variable m_writable_cv;							///< Wakes WaitWritable()
+			std::deque<Segment> m_queue;									///< Pending segments
+			std::size_t m_bytes;											///< Unwritten queued bytes
+			bool m_flushing;												///< Waiting for / running a flush
+			bool m_paused;													///< High watermark reached
+			bool m_failed;													///< Socket failed; nothing is sent any more
+			SlowConsumerOptions m_limits;									///< Slow consumer limits
+			Clock::time_point m_last_progress;								///< Last write progress (or start of the wait)
+			std::uint64_t m_sent;											///< Bytes written
+			std::uint64_t m_dropped;										///< Fan-out frames dropped
+			bool m_overflowed;												///< Fan-out frame refused under Disconnect
+			std::shared_ptr<Budget> m_budget;								///< Admission budget (optional)
+			std::size_t m_charged;											///< Bytes counted against m_budget
+			std::vector<std::move_only_function<void()>> m_when_writable;	///< One-shot writability callbacks
+			std::mutex m_change_mutex;										///< Serializes m_on_change calls and updates
+			std::function<void(bool)> m_on_change;							///< Writability transition callback
+
+			/**
+			 * Sends or queues @p data (caller holds @p lock, which is released).
+			 * @param lock Lock on m_mutex.
+			 * @param data Bytes to send.
+			 * @param key Conflation key.
+			 * @param droppable Fan-out frame.
+			 * @return false if the socket failed.
+			 */
+			bool Enqueue(std::unique_lock<std::mutex>& lock, std::shared_ptr<const Buffer::DataType> data, const std::string& key, const bool& droppable) noexcept;
+
+			/**
+			 * Drops unsent fan-out frames, oldest first, until @p incoming more
+			 * bytes fit under SlowConsumerOptions::max_queued_bytes (caller holds
+			 * m_mutex).
+			 * @param incoming Bytes about to be queued (SIZE_MAX drops them all).
+			 * @return Number of frames dropped.
+			 */
+			std::size_t DropOldest(const std::size_t& incoming) noexcept;
+
+			/**
+			 * Brings the @ref Charge() budget up to date (caller holds m_mutex).
+			 */
+			void Recount() noexcept;
+
+			/**
+			 * Applies watermark transitions after the queue changed, then releases
+			 * @p lock and reports them.
+			 * @param lock Lock on m_mutex.
+			 */
+			void Settle(std::unique_lock<std::mutex>& lock) noexcept;
+
+			/**
+			 * Registers with Executor::WritePoller to continue flushing.
+			 */
+			void Arm() noexcept;
+
+			/**
+			 * Writes queued segments until the queue is empty or the socket is full.
+			 */
+			void Flush() noexcept;
+
+			/**
+			 * Drops the queue and marks the outbox failed (caller holds m_mutex).
+			 * @return Writability callbacks to run after unlocking.
+			 */
+			std::vector<std::move_only_function<void()>> Fail() noexcept;
+
+			/**
+			 * Reports a writability transition.
+			 * @param writable New state.
+			 */
+			void NotifyChange(const bool& writable) noexcept;
+	};
+}
@@ -0,0 +1,82 @@
+#include <StormByte/network/connection/rate_limiter.hxx>
+
+#include <algorithm>
+
+#ifdef LINUX
+#include <time.h>
+#endif
+
+using namespace StormByte::Network::Connection;
+
+namespace {
+	constexpr std::int64_t TOKEN = 1000;	///< One token, in thousandths
+}
+
+void RateLimiter::Bucket::Refill(const std::int64_t& now) noexcept {
+	if (now > updated) {
+		tokens = std::min(capacity, tokens + (now - updated) * rate);
+		updated = now;
+	}
+}
+
+std::int64_t RateLimiter::Bucket::Wait() const noexcept {
+	return tokens >= TOKEN ? 0 : (TOKEN - tokens + rate - 1) / rate;
+}
+
+RateLimiter::RateLimiter(const RateLimitOptions& options) noexcept:
+	m_action(options.action),
+	m_enabled(options.connection.rate > 0),
+	m_connection(),
+	m_opcodes() {
+	const std::int64_t now = Now();
+	m_connection = MakeBucket(options.connection, now);
+	for (const auto& [opcode, limit] : options.opcodes) {
+		if (limit.rate == 0)
+			continue;
+		m_opcodes.emplace(opcode, MakeBucket(limit, now));
+		m_enabled = true;
+	}
+}
+
+std::chrono::milliseconds RateLimiter::Take(const Transport::Packet::OpcodeType& opcode) noexcept {
+	if (!m_enabled)
+		return std::chrono::milliseconds::zero();
+
+	const std::int64_t now = Now();
+	Bucket* buckets[2] = { m_connection.rate > 0 ? &m_connection : nullptr, nullptr };
+	if (auto it = m_opcodes.find(opcode); it != m_opcodes.end())
+		buckets[1] = &it->second;
+
+	std::int64_t wait = 0;
+	for (Bucket* bucket : buckets) {
+		if (bucket) {
+			bucket->Refill(now);
+			wait = std::max(wait, bucket->Wait());
+		}
+	}
+
+	// Delayed frames are still handled, so they pay now and the wait covers the debt
+	if (wait == 0 || m_action == RateLimitAction::Delay) {
+		for (Bucket* bucket : buckets) {
+			if (bucket)
+				bucket->tokens -= TOKEN;
+		}
+	}
+	return std::chrono::milliseconds(wait);
+}
+
+RateLimiter::Bucket RateLimiter::MakeBucket(const RateLimit& limit, const std::int64_t& now) noexcept {
+	const std::int64_t capacity = static_cast<std::int64_t>(limit.burst > 0 ? limit.burst : std::max(1u, limit.rate)) * TOKEN;
+	return Bucket { .rate = limit.rate, .capacity = capacity, .tokens = capacity, .updated = now };
+}
+
+std::int64_t RateLimiter::Now() noexcept {
+#ifdef LINUX
+	// Tick-resolution clock read from the vDSO, without a system call
+	timespec ts;
+	clock_gettime(CLOCK_MONOTONIC_COARSE, &ts);
+	return static_cast<std::int64_t>(ts.tv_sec) * 1000 + ts.tv_nsec / 1000000;
+#else
+	return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <StormByte/network/connection/rate_limit.hxx>
+
+#include <chrono>
+#include <cstdint>
+#include <unordered_map>
+
+/**
+ * @namespace Connection
+ * @brief Connection-level types (protocol, status, read/write results).
+ */
+namespace StormByte::Network::Connection {
+	/**
+	 * @class RateLimiter
+	 * @brief Token buckets of one connection (see RateLimitOptions).
+	 *
+	 * Not thread-safe: it is owned by the connection's receive thread. Tokens
+	 * are kept in thousandths and refilled from a coarse monotonic clock, so
+	 * a check is a few integer operations.
+	 */
+	class STORMBYTE_NETWORK_PRIVATE RateLimiter final {
+		public:
+			/**
+			 * @param options Limits.
+			 */
+			explicit RateLimiter(const RateLimitOptions& options) noexcept;
+
+			/**
+			 * Copy constructor (deleted).
+			 */
+			RateLimiter(const RateLimiter& other) = delete;
+
+			/**
+			 * Move constructor.
+			 */
+			RateLimiter(RateLimiter&& other) noexcept = default;
+
+			/**
+			 * Destructor.
+			 */
+			~RateLimiter() noexcept = default;
+
+			/**
+			 * Copy assignment (deleted).
+			 */
+			RateLimiter& operator=(const RateLimiter& other) = delete;
+
+			/**
+			 * Move assignment.
+			 */
+			RateLimiter& operator=(RateLimiter&& other) noexcept = default;
+
+			/**
+			 * Takes a token for a frame with @p opcode.
+			 *
+			 * Under RateLimitAction::Delay the token is always taken (buckets
+			 * may go into debt) and the result is how long to wait before
+			 * handling the frame; otherwise nothing is taken when a bucket is
+			 * empty.
+			 * @param opcode Frame opcode.
+			 * @return Zero if the frame is within the limits, else the time
+			 * until it would be.
+			 */
+			std::chrono::milliseconds Take(const Transport::Packet::OpcodeType& opcode) noexcept;
+
+			/**
+			 * @return Action for frames over a limit.
+			 */
+			inline RateLimitAction Action() const noexcept {
+				return m_action;
+			}
+
+			/**
+			 * @return true if any limit is set.
+			 */
+			inline bool Enabled() const noexcept {
+				return m_enabled;
+			}
+
+		private:
+			/**
+			 * @struct Bucket
+			 * @brief Token bucket in thousandths of a token.
+			 */
+			struct Bucket {
+				std::int64_t rate;			///< Refill per millisecond (= frames per second)
+				std::int64_t capacity;		///< Maximum tokens
+				std::int64_t tokens;		///< Current tokens (negative when in debt)
+				std::int64_t updated;		///< Last refill (coarse clock, ms)
+
+				/**
+				 * Refills up to @p now.
+				 * @param now Coarse clock reading (ms).
+				 */
+				void Refill(const std::int64_t& now) noexcept;
+
+				/**
+				 * @return Milliseconds until a token is available (0 if one is).
+				 */
+				std::int64_t Wait() const noexcept;
+			};
+
+			RateLimitAction m_action;								///< Action over a limit
+			bool m_enabled;											///< Any limit set
+			Bucket m_connection;									///< All frames (rate 0 = unlimited)
+			std::unordered_map<Transport::Packet::OpcodeType, Bucket> m_opcodes;	///< Per-opcode buckets
+
+			/**
+			 * @param limit Configured limit.
+			 * @param now Coarse clock reading (ms).
+			 * @return Full bucket for @p limit.
+			 */
+			static Bucket MakeBucket(const RateLimit& limit, const std::int64_t& now) noexcept;
+
+			/**
+			 * @return Coarse monotonic clock (ms); a vDSO read on Linux.
+			 */
+			static std::int64_t Now() noexcept;
+	};
+}
@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <StormByte/network/connection/id.hxx>
+
+#include <optional>
+#include <vector>
+
+/**
+ * @namespace Connection
+ * @brief Connection-level types (protocol, status, read/write results).
+ */
+namespace StormByte::Network::Connection {
+	/**
+	 * @class Registry
+	 * @brief Slab of values addressed by generation-counted @ref ID.
+	 *
+	 * Insert, lookup and erase are O(1): IDs index a vector directly and
+	 * freed slots are recycled through a free list with their generation
+	 * bumped. Not thread-safe; callers serialize access.
+	 *
+	 * @tparam T Stored value type (movable).
+	 */
+	template <typename T>
+	class Registry final {
+		public:
+			/**
+			 * Empty registry.
+			 */
+			Registry() noexcept = default;
+
+			/**
+			 * Copy constructor (deleted).
+			 */
+			Registry(const Registry& other) = delete;
+
+			/**
+			 * Move constructor.
+			 */
+			Registry(Registry&& other) noexcept = default;
+
+			/**
+			 * Destructor.
+			 */
+			~Registry() noexcept = default;
+
+			/**
+			 * Copy assignment (deleted).
+			 */
+			Registry& operator=(const Registry& other) = delete;
+
+			/**
+			 * Move assignment.
+			 */
+			Registry& operator=(Registry&& other) noexcept = default;
+
+			/**
+			 * Stores @p value in a free (or new) slot.
+			 * @param value Value to store.
+			 * @return ID of the stored value.
+			 */
+			ID Insert(T&& value) {
+				std::uint32_t index;
+				if (!m_free.empty()) {
+					index = m_free.back();
+					m_free.pop_back();
+				}
+				else {
+					index = static_cast<std::uint32_t>(m_slots.size());
+					m_slots.emplace_back();
+				}
+
+				Slot& slot = m_slots[index];
+				slot.value.emplace(std::move(value));
+				++m_size;
+				return ID(index, slot.generation);
+			}
+
+			/**
+			 * @param id Value ID.
+			 * @return Pointer to the value, or nullptr if @p id is stale / unknown.
+			 */
+			T* Find(const ID& id) noexcept {
+				Slot* slot = Lookup(id);
+				return slot ? &*slot->value : nullptr;
+			}
+
+			/**
+			 * @param id Value ID.
+			 * @return Pointer to the value, or nullptr if @p id is stale / unknown.
+			 */
+			const T* Find(const ID& id) const noexcept {
+				return const_cast<Registry*>(this)->Find(id);
+			}
+
+			/**
+			 * Removes a value and recycles its slot.
+			 * @param id Value ID.
+			 * @return Removed value, or std::nullopt if @p id is stale / unknown.
+			 */
+			std::optional<T> Erase(const ID& id) noexcept {
+				Slot* slot = Lookup(id);
+				if (!slot)
+					return std::nullopt;
+
+				std::optional<T> value(std::move(slot->value));
+				slot->value.reset();
+				++slot->generation;
+				m_free.push_back(id.Index());
+				--m_size;
+				return value;
+			}
+
+			/**
+			 * Calls @p function(id, value) for every stored value.
+			 * @param function Visitor.
+			 */
+			template <typename F>
+			void ForEach(F&& function) {
+				for (std::size_t i = 0; i < m_slots.size(); ++i) {
+					if (m_slots[i].value)
+						function(ID(static_cast<std::uint32_t>(i), m_slots[i].generation), *m_slots[i].value);
+				}
+			}
+
+			/**
+			 * @return Number of stored values.
+			 */
+			inline std::size_t Size() const noexcept {
+				return m_size;
+			}
+
+		private:
+			/**
+			 * @struct Slot
+			 * @brief One registry entry.
+			 */
+			struct Slot {
+				std::uint32_t generation = 0;	///< Bumped on every erase
+				std::optional<T> value;			///< Stored value (empty when free)
+			};
+
+			std::vector<Slot> m_slots;				///< Slab
+			std::vector<std::uint32_t> m_free;		///< Free slot indices
+			std::size_t m_size = 0;					///< Stored values
+
+			/**
+			 * @param id Value ID.
+			 * @return Occupied slot matching @p id, or nullptr.
+			 */
+			Slot* Lookup(const ID& id) noexcept {
+				if (id.Index() >= m_slots.size())
+					return nullptr;
+				Slot& slot = m_slots[id.Index()];
+				return slot.value && slot.generation == id.Generation() ? &slot : nullptr;
+			}
+	};
+}
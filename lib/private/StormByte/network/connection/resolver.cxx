@@ -0,0 +1,134 @@
+#include <StormByte/network/connection/resolver.hxx>
+
+#ifdef UNIX
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netdb.h>
+#else
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#endif
+
+#include <StormByte/network/connection/handler.hxx>
+
+#include <cstring>
+
+using namespace StormByte::Network::Connection;
+
+Resolver::Resolver(QueryFunction query) noexcept:
+	m_query(std::move(query)), m_lookups(THREADS) {}
+
+Resolver& Resolver::Instance() noexcept {
+	static Resolver instance;
+	return instance;
+}
+
+std::shared_future<Resolver::AnswerPointer> Resolver::Lookup(const std::string& hostname, const Protocol& protocol) noexcept {
+	const std::string key = std::to_string(ProtocolInt(protocol)) + "/" + hostname;
+	std::scoped_lock lock(m_mutex);
+
+	auto it = m_cache.find(key);
+	if (it == m_cache.end()) {
+		if (m_cache.size() >= MAX_ENTRIES)
+			Prune();
+		return Start(key, hostname, protocol, nullptr);
+	}
+
+	Entry& entry = it->second;
+	if (entry.refreshing || entry.answer.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+		return entry.answer;
+
+	const AnswerPointer answer = entry.answer.get();
+	if (std::chrono::steady_clock::now() < answer->expiry)
+		return entry.answer;
+
+	// Stale addresses are still the best guess while the refresh runs
+	if (!answer->addresses.empty()) {
+		std::shared_future<AnswerPointer> stale = entry.answer;
+		Start(key, hostname, protocol, answer);
+		return stale;
+	}
+	return Start(key, hostname, protocol, nullptr);
+}
+
+std::shared_future<Resolver::AnswerPointer> Resolver::Start(const std::string& key, const std::string& hostname, const Protocol& protocol, AnswerPointer stale) noexcept {
+	auto promise = std::make_shared<std::promise<AnswerPointer>>();
+	std::shared_future<AnswerPointer> future = promise->get_future().share();
+
+	Entry& entry = m_cache[key];
+	if (stale)
+		entry.refreshing = true;
+	else
+		entry.answer = future;
+
+	m_lookups.Submit([this, key, hostname, protocol, promise, future, stale = std::move(stale)]() {
+		AnswerPointer answer = m_query(hostname, protocol);
+		if (answer->addresses.empty() && stale) {
+			// Keep the old addresses rather than fail connects to a host that was reachable
+			answer = std::make_shared<const Answer>(Answer {
+				stale->addresses, {}, std::chrono::steady_clock::now() + NEGATIVE_TTL
+			});
+		}
+		promise->set_value(std::move(answer));
+
+		std::scoped_lock lock(m_mutex);
+		auto it = m_cache.find(key);
+		if (it != m_cache.end()) {
+			it->second.answer = future;
+			it->second.refreshing = false;
+		}
+	});
+	return future;
+}
+
+Resolver::AnswerPointer Resolver::Query(const std::string& hostname, const Protocol& protocol) noexcept {
+	(void)Handler::Instance();
+
+	struct addrinfo hints{}, *res = nullptr;
+	hints.ai_family = ProtocolInt(protocol);
+	hints.ai_socktype = SOCK_STREAM;
+
+	Answer answer;
+	const int ret = getaddrinfo(hostname.c_str(), nullptr, &hints, &res);
+	if (ret != 0 || !res) {
+#ifdef WINDOWS
+		// UNICODE maps gai_strerror to the wide variant
+		answer.error = gai_strerrorA(ret);
+#else
+		answer.error = gai_strerror(ret);
+#endif
+		answer.expiry = std::chrono::steady_clock::now() + NEGATIVE_TTL;
+		return std::make_shared<const Answer>(std::move(answer));
+	}
+
+	std::unique_ptr<addrinfo, decltype(&freeaddrinfo)> res_guard(res, freeaddrinfo);
+	for (const addrinfo* entry = res; entry; entry = entry->ai_next) {
+		if (entry->ai_family != AF_INET && entry->ai_family != AF_INET6)
+			continue;
+
+		sockaddr_storage address{};
+		std::memcpy(&address, entry->ai_addr, entry->ai_addrlen);
+		answer.addresses.push_back(address);
+	}
+
+	if (answer.addresses.empty()) {
+		answer.error = "Unable to determine resolved address";
+		answer.expiry = std::chrono::steady_clock::now() + NEGATIVE_TTL;
+	}
+	else
+		answer.expiry = std::chrono::steady_clock::now() + TTL;
+	return std::make_shared<const Answer>(std::move(answer));
+}
+
+void Resolver::Prune() noexcept {
+	const auto now = std::chrono::steady_clock::now();
+	auto settled = [](const Entry& entry) {
+		return !entry.refreshing && entry.answer.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+	};
+
+	std::erase_if(m_cache, [&](const auto& item) {
+		return settled(item.second) && item.second.answer.get()->expiry <= now;
+	});
+	if (m_cache.size() >= MAX_ENTRIES)
+		std::erase_if(m_cache, [&](const auto& item) { return settled(item.second); });
+}
@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <StormByte/network/connection/protocol.hxx>
+#include <StormByte/network/executor/pool.hxx>
+
+#ifdef WINDOWS
+#include <winsock2.h>
+#else
+#include <sys/socket.h>
+#endif
+
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @namespace Connection
+ * @brief Connection helpers (handler, info, client wrapper).
+ */
+namespace StormByte::Network::Connection {
+	/**
+	 * @class Resolver
+	 * @brief Asynchronous host name resolver with a shared answer cache.
+	 *
+	 * getaddrinfo() runs on a small pool of its own, so a slow DNS server never
+	 * holds a caller or a pipeline worker, and concurrent lookups of one name
+	 * share a single query. Answers are cached for @ref TTL (failures for
+	 * @ref NEGATIVE_TTL); an expired answer keeps being served while one
+	 * background lookup refreshes it, so only the first connect to a host
+	 * waits for the resolver.
+	 *
+	 * getaddrinfo() does not expose record TTLs, hence the fixed lifetime.
+	 * Non-copyable / non-movable.
+	 */
+	class STORMBYTE_NETWORK_PRIVATE Resolver final {
+		public:
+			static constexpr std::chrono::seconds TTL { 60 };			///< Lifetime of a resolved answer
+			static constexpr std::chrono::seconds NEGATIVE_TTL { 5 };	///< Lifetime of a failed lookup
+			static constexpr std::size_t MAX_ENTRIES = 1024;			///< Cached names before pruning
+			static constexpr std::size_t THREADS = 2;					///< Concurrent getaddrinfo() calls
+
+			/**
+			 * @struct Answer
+			 * @brief Addresses of one name, with port 0.
+			 */
+			struct Answer {
+				std::vector<sockaddr_storage> addresses;			///< Resolver order (empty on failure)
+				std::string error;									///< Failure reason
+				std::chrono::steady_clock::time_point expiry;		///< Fresh until
+			};
+			using AnswerPointer = std::shared_ptr<const Answer>;	///< Shared immutable answer
+			using QueryFunction = std::function<AnswerPointer(const std::string&, const Protocol&)>;	///< Blocking lookup of one name
+
+			/**
+			 * Constructor.
+			 * @param query Blocking lookup run on the resolver threads (getaddrinfo() by default).
+			 */
+			explicit Resolver(QueryFunction query = Query) noexcept;
+
+			/**
+			 * Copy constructor (deleted).
+			 */
+			Resolver(const Resolver& other) = delete;
+
+			/**
+			 * Move constructor (deleted).
+			 */
+			Resolver(Resolver&& other) noexcept = delete;
+
+			/**
+			 * Destructor (finishes running lookups).
+			 */
+			~Resolver() noexcept = default;
+
+			/**
+			 * Copy assignment (deleted).
+			 */
+			Resolver& operator=(const Resolver& other) = delete;
+
+			/**
+			 * Move assignment (deleted).
+			 */
+			Resolver& operator=(Resolver&& other) noexcept = delete;
+
+			/**
+			 * @return Library-wide resolver.
+			 */
+			static Resolver& Instance() noexcept;
+
+			/**
+			 * Looks @p hostname up, reusing a cached or in-flight answer.
+			 * @param hostname Host name or literal address.
+			 * @param protocol Address family (Protocol::Any for both).
+			 * @return Future answer (already ready on a cache hit).
+			 */
+			std::shared_future<AnswerPointer> Lookup(const std::string& hostname, const Protocol& protocol) noexcept;
+
+		private:
+			/**
+			 * @struct Entry
+			 * @brief Cache slot of one name and family.
+			 */
+			struct Entry {
+				std::shared_future<AnswerPointer> answer;	///< Latest answer (or the pending first one)
+				bool refreshing = false;					///< A lookup is replacing @ref answer
+			};
+
+			std::unordered_map<std::string, Entry> m_cache;	///< Answers by family and name
+			std::mutex m_mutex;									///< Protects m_cache
+			const QueryFunction m_query;						///< Blocking lookup
+			Executor::Pool m_lookups;							///< Runs getaddrinfo() (destroyed first)
+
+			/**
+			 * Queues a lookup whose answer replaces @p key's entry. Requires m_mutex.
+			 * @param key Cache key.
+			 * @param hostname Host name.
+			 * @param protocol Address family.
+			 * @param stale Answer kept if the lookup fails (nullptr = none).
+			 * @return Future answer.
+			 */
+			std::shared_future<AnswerPointer> Start(const std::string& key, const std::string& hostname, const Protocol& protocol, AnswerPointer stale) noexcept;
+
+			/**
+			 * Blocking getaddrinfo() call.
+			 * @param hostname Host name.
+			 * @param protocol Address family.
+			 * @return Answer (with error on failure).
+			 */
+			static AnswerPointer Query(const std::string& hostname, const Protocol& protocol) noexcept;
+
+			/**
+			 * Drops expired answers, or every settled one if that is not
+			 * enough, to keep the cache under MAX_ENTRIES. Requires m_mutex.
+			 */
+			void Prune() noexcept;
+	};
+}
@@ -0,0 +1,210 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <StormByte/network/connection/registry.hxx>
+
+#include <array>
+#include <atomic>
+#include <mutex>
+
+/**
+ * @namespace Connection
+ * @brief Connection-level types (protocol, status, read/write results).
+ */
+namespace StormByte::Network::Connection {
+	/**
+	 * @class ShardedRegistry
+	 * @brief Thread-safe @ref Registry split into independently locked shards.
+	 *
+	 * The shard is encoded in the low bits of the ID index, so every
+	 * operation locks exactly one shard and only contends with operations on
+	 * the same shard. Inserts rotate over the shards with a per-thread
+	 * cursor, so a single accepting thread still spreads its clients and no
+	 * shared counter is touched on the hot path.
+	 *
+	 * @tparam T Stored value type (movable).
+	 * @tparam SHARDS Number of shards (power of two).
+	 */
+	template <typename T, std::size_t SHARDS = 16>
+	class ShardedRegistry {
+		static_assert(SHARDS > 0 && (SHARDS & (SHARDS - 1)) == 0, "ShardedRegistry shard count must be a power of two");
+
+		public:
+			/**
+			 * Empty registry.
+			 */
+			ShardedRegistry() noexcept = default;
+
+			/**
+			 * Copy constructor (deleted).
+			 */
+			ShardedRegistry(const ShardedRegistry& other) = delete;
+
+			/**
+			 * Move constructor (deleted).
+			 */
+			ShardedRegistry(ShardedRegistry&& other) noexcept = delete;
+
+			/**
+			 * Destructor.
+			 */
+			~ShardedRegistry() noexcept = default;
+
+			/**
+			 * Copy assignment (deleted).
+			 */
+			ShardedRegistry& operator=(const ShardedRegistry& other) = delete;
+
+			/**
+			 * Move assignment (deleted).
+			 */
+			ShardedRegistry& operator=(ShardedRegistry&& other) noexcept = delete;
+
+			/**
+			 * Stores @p value in the next shard.
+			 * @param value Value to store.
+			 * @return ID of the stored value.
+			 */
+			ID Insert(T&& value) {
+				const std::size_t shard = NextShard();
+				Shard& target = m_shards[shard];
+				std::scoped_lock lock(target.mutex);
+				return Global(target.registry.Insert(std::move(value)), shard);
+			}
+
+			/**
+			 * Runs @p function on the value under its shard lock.
+			 * @param id Value ID.
+			 * @param function Callable taking const T&.
+			 * @return false if @p id is stale / unknown.
+			 */
+			template <typename F>
+			bool Read(const ID& id, F&& function) const {
+				const Shard& target = m_shards[ShardOf(id)];
+				std::scoped_lock lock(target.mutex);
+				const T* value = target.registry.Find(Local(id));
+				if (!value)
+					return false;
+				function(*value);
+				return true;
+			}
+
+			/**
+			 * Runs @p function on the mutable value under its shard lock.
+			 * @param id Value ID.
+			 * @param function Callable taking T&.
+			 * @return false if @p id is stale / unknown.
+			 */
+			template <typename F>
+			bool Modify(const ID& id, F&& function) {
+				Shard& target = m_shards[ShardOf(id)];
+				std::scoped_lock lock(target.mutex);
+				T* value = target.registry.Find(Local(id));
+				if (!value)
+					return false;
+				function(*value);
+				return true;
+			}
+
+			/**
+			 * Removes a value and recycles its slot.
+			 * @param id Value ID.
+			 * @return Removed value, or std::nullopt if @p id is stale / unknown.
+			 */
+			std::optional<T> Erase(const ID& id) noexcept {
+				Shard& target = m_shards[ShardOf(id)];
+				std::scoped_lock lock(target.mutex);
+				return target.registry.Erase(Local(id));
+			}
+
+			/**
+			 * Calls @p function(id, value) for every value, one shard lock at a time.
+			 * @param function Visitor (must not call back into the registry).
+			 */
+			template <typename F>
+			void ForEach(F&& function) {
+				for (std::size_t shard = 0; shard < SHARDS; ++shard) {
+					std::scoped_lock lock(m_shards[shard].mutex);
+					m_shards[shard].registry.ForEach([&function, shard](const ID& local, T& value) {
+						function(Global(local, shard), value);
+					});
+				}
+			}
+
+			/**
+			 * @return Number of stored values (approximate while others modify it).
+			 */
+			std::size_t Size() const noexcept {
+				std::size_t size = 0;
+				for (const auto& shard : m_shards) {
+					std::scoped_lock lock(shard.mutex);
+					size += shard.registry.Size();
+				}
+				return size;
+			}
+
+		private:
+			/**
+			 * @struct Shard
+			 * @brief One lock + registry pair, on its own cache line.
+			 */
+			struct alignas(64) Shard {
+				mutable std::mutex mutex;	///< Protects registry
+				Registry<T> registry;		///< Shard values
+			};
+
+			std::array<Shard, SHARDS> m_shards;	///< Shards
+
+			/**
+			 * @return Shard for the calling thread's next insert.
+			 */
+			static std::size_t NextShard() noexcept {
+				static std::atomic<std::size_t> start {0};
+				thread_local std::size_t cursor = start.fetch_add(1, std::memory_order_relaxed);
+				return cursor++ & (SHARDS - 1);
+			}
+
+			/**
+			 * @param id Global ID.
+			 * @return Shard holding @p id.
+			 */
+			static constexpr std::size_t ShardOf(const ID& id) noexcept {
+				return id.Index() & (SHARDS - 1);
+			}
+
+			/**
+			 * @param id Global ID.
+			 * @return ID inside its shard (invalid IDs stay out of range).
+			 */
+			static constexpr ID Local(const ID& id) noexcept {
+				return id.Valid() ? ID(id.Index() / SHARDS, id.Generation()) : ID();
+			}
+
+			/**
+			 * @param local ID inside @p shard.
+			 * @param shard Shard index.
+			 * @return Global ID.
+			 */
+			static constexpr ID Global(const ID& local, const std::size_t& shard) noexcept {
+				return ID(static_cast<std::uint32_t>(local.Index() * SHARDS + shard), local.Generation());
+			}
+	};
+}
@@ -0,0 +1,75 @@
+#include <StormByte/network/connection/client.hxx>
+#include <StormByte/network/connection/subscriber.hxx>
+
+#include <algorithm>
+#include <utility>
+
+using namespace StormByte::Network::Connection;
+
+Subscriber::Subscriber(const ID& id, std::shared_ptr<Client> connection, const SubscriberOptions& options) noexcept:
+	m_id(id),
+	m_connection(connection),
+	m_options { .queue_size = std::max<std::size_t>(1, options.queue_size), .policy = options.policy },
+	m_queue(),
+	m_draining(false),
+	m_dropped(0) {}
+
+bool Subscriber::Push(const std::string& topic, std::shared_ptr<const Buffer::DataType> frame) noexcept {
+	if (!IsConnected(m_connection->Status()))
+		return false;
+
+	std::scoped_lock lock(m_mutex);
+	if (m_options.policy == QueuePolicy::Conflate) {
+		auto queued = std::find_if(m_queue.begin(), m_queue.end(), [&topic](const Entry& entry) {
+			return entry.topic == topic;
+		});
+		if (queued != m_queue.end()) {
+			// Latest value wins, keeping the topic's place in the queue
+			queued->frame = std::move(frame);
+			m_dropped.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+	}
+
+	if (m_queue.size() >= m_options.queue_size) {
+		m_dropped.fetch_add(1, std::memory_order_relaxed);
+		if (m_options.policy == QueuePolicy::DropNewest)
+			return false;
+		m_queue.pop_front();
+	}
+
+	m_queue.push_back(Entry { .topic = topic, .frame = std::move(frame) });
+	return !std::exchange(m_draining, true);
+}
+
+void Subscriber::Drain(std::shared_ptr<Logger::Log> logger) noexcept {
+	while (true) {
+		// Resume once the connection drains; publications keep queueing (and conflating) here meanwhile.
+		// A failed connection is not waited on: the send below fails and drops the queue.
+		if (!m_connection->Writable() && m_connection->WhenWritable([self = shared_from_this(), logger] {
+			self->Drain(logger);
+		}))
+			return;
+
+		Entry entry;
+		{
+			std::scoped_lock lock(m_mutex);
+			if (m_queue.empty()) {
+				m_draining = false;
+				return;
+			}
+			entry = std::move(m_queue.front());
+			m_queue.pop_front();
+		}
+
+		if (!m_connection->SendEncoded(std::move(entry.frame), entry.topic, logger)) {
+			std::scoped_lock lock(m_mutex);
+			logger << Logger::Level::Error << "Dropping " << m_queue.size() + 1 << " publications for client="
+					<< m_id.ToString() << std::endl;
+			m_dropped.fetch_add(m_queue.size() + 1, std::memory_order_relaxed);
+			m_queue.clear();
+			m_draining = false;
+			return;
+		}
+	}
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <StormByte/network/connection/id.hxx>
+#include <StormByte/network/connection/subscriber_options.hxx>
+#include <StormByte/network/typedefs.hxx>
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+
+/**
+ * @namespace Connection
+ * @brief Connection-level types (protocol, status, read/write results).
+ */
+namespace StormByte::Network::Connection {
+	class Client;	///< Forward declaration
+
+	/**
+	 * @class Subscriber
+	 * @brief Bounded queue of encoded publications for one client.
+	 *
+	 * Publishers @ref Push() shared encoded frames; the first push into an
+	 * idle queue tells its caller to schedule a @ref Drain(), which writes
+	 * until the queue is empty. At most one drain runs at a time, so frames
+	 * leave in queue order; while the connection is not writable the drain
+	 * pauses and publications wait here, where the queue policy applies.
+	 * Non-copyable / non-movable; always owned by a std::shared_ptr.
+	 */
+	class STORMBYTE_NETWORK_PRIVATE Subscriber final: public std::enable_shared_from_this<Subscriber> {
+		public:
+			/**
+			 * @param id Client ID.
+			 * @param connection Client connection.
+			 * @param options Queue size and policy.
+			 */
+			Subscriber(const ID& id, std::shared_ptr<Client> connection, const SubscriberOptions& options) noexcept;
+
+			/**
+			 * Copy constructor (deleted).
+			 */
+			Subscriber(const Subscriber& other) = delete;
+
+			/**
+			 * Move constructor (deleted).
+			 */
+			Subscriber(Subscriber&& other) noexcept = delete;
+
+			/**
+			 * Destructor.
+			 */
+			~Subscriber() noexcept = default;
+
+			/**
+			 * Copy assignment (deleted).
+			 */
+			Subscriber& operator=(const Subscriber& other) = delete;
+
+			/**
+			 * Move assignment (deleted).
+			 */
+			Subscriber& operator=(Subscriber&& other) noexcept = delete;
+
+			/**
+			 * Queues a publication, applying the queue policy when full.
+			 * @param topic Publication topic.
+			 * @param frame Encoded publish frame.
+			 * @return true if the caller must schedule @ref Drain().
+			 */
+			bool Push(const std::string& topic, std::shared_ptr<const Buffer::DataType> frame) noexcept;
+
+			/**
+			 * Sends queued publications until the queue is empty, pausing while
+			 * the connection is not writable. A failed send discards the rest
+			 * of the queue.
+			 * @param logger Logger.
+			 */
+			void Drain(std::shared_ptr<Logger::Log> logger) noexcept;
+
+			/**
+			 * @return Client ID.
+			 */
+			inline const Connection::ID& ClientID() const noexcept {
+				return m_id;
+			}
+
+			/**
+			 * @return Client connection.
+			 */
+			inline const std::shared_ptr<Client>& Peer() const noexcept {
+				return m_connection;
+			}
+
+			/**
+			 * @return Publications discarded so far (policy or failed sends).
+			 */
+			inline std::uint64_t Dropped() const noexcept {
+				return m_dropped.load(std::memory_order_relaxed);
+			}
+
+		private:
+			/**
+			 * @struct Entry
+			 * @brief Queued publication.
+			 */
+			struct Entry {
+				std::string topic;								///< Publication topic
+				std::shared_ptr<const Buffer::DataType> frame;	///< Encoded frame (shared with other subscribers)
+			};
+
+			const Connection::ID m_id;					///< Client ID
+			std::shared_ptr<Client> m_connection;		///< Client connection
+			const SubscriberOptions m_options;			///< Queue size and policy
+			std::deque<Entry> m_queue;					///< Pending publications
+			std::mutex m_mutex;							///< Protects m_queue / m_draining
+			bool m_draining;							///< A drain is scheduled or running
+			std::atomic<std::uint64_t> m_dropped;		///< Discarded publications
+	};
+}
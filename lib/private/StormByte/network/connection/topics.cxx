@@ -0,0 +1,68 @@
+#include <StormByte/network/connection/topics.hxx>
+
+using namespace StormByte::Network::Connection;
+
+bool Topics::Subscribe(const std::string& topic, const ID& id, std::shared_ptr<Client> connection, const SubscriberOptions& options) noexcept {
+	std::unique_lock lock(m_mutex);
+	auto [entry, created] = m_subscribers.try_emplace(id);
+	if (created)
+		entry->second.subscriber = std::make_shared<Subscriber>(id, connection, options);
+	if (!entry->second.topics.insert(topic).second)
+		return false;
+
+	auto list = std::make_shared<SubscriberList>();
+	if (auto current = m_topics.find(topic); current != m_topics.end()) {
+		list->reserve(current->second->size() + 1);
+		*list = *current->second;
+	}
+	list->push_back(entry->second.subscriber);
+	m_topics[topic] = std::move(list);
+	return true;
+}
+
+bool Topics::Unsubscribe(const std::string& topic, const ID& id) noexcept {
+	std::unique_lock lock(m_mutex);
+	auto entry = m_subscribers.find(id);
+	if (entry == m_subscribers.end() || entry->second.topics.erase(topic) == 0)
+		return false;
+
+	Detach(topic, id);
+	if (entry->second.topics.empty())
+		m_subscribers.erase(entry);
+	return true;
+}
+
+void Topics::Remove(const ID& id) noexcept {
+	std::unique_lock lock(m_mutex);
+	auto entry = m_subscribers.find(id);
+	if (entry == m_subscribers.end())
+		return;
+
+	for (const auto& topic : entry->second.topics)
+		Detach(topic, id);
+	m_subscribers.erase(entry);
+}
+
+std::shared_ptr<const Topics::SubscriberList> Topics::Subscribers(const std::string& topic) const noexcept {
+	std::shared_lock lock(m_mutex);
+	auto current = m_topics.find(topic);
+	return current != m_topics.end() ? current->second : nullptr;
+}
+
+void Topics::Detach(const std::string& topic, const ID& id) noexcept {
+	auto current = m_topics.find(topic);
+	if (current == m_topics.end())
+		return;
+
+	auto list = std::make_shared<SubscriberList>();
+	list->reserve(current->second->size());
+	for (const auto& subscriber : *current->second) {
+		if (subscriber->ClientID() != id)
+			list->push_back(subscriber);
+	}
+
+	if (list->empty())
+		m_topics.erase(current);
+	else
+		current->second = std::move(list);
+}
@@ -0,0 +1,126 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <StormByte/network/connection/subscriber.hxx>
+
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @namespace Connection
+ * @brief Connection-level types (protocol, status, read/write results).
+ */
+namespace StormByte::Network::Connection {
+	/**
+	 * @class Topics
+	 * @brief Topic index: which subscribers receive each topic.
+	 *
+	 * Every topic keeps an immutable subscriber list that is rebuilt on
+	 * (un)subscription, so publishing only copies one shared pointer under
+	 * a shared lock no matter how many clients are subscribed.
+	 * Non-copyable / non-movable.
+	 */
+	class STORMBYTE_NETWORK_PRIVATE Topics final {
+		public:
+			using SubscriberList = std::vector<std::shared_ptr<Subscriber>>;	///< Subscribers of one topic
+
+			/**
+			 * Empty index.
+			 */
+			Topics() noexcept = default;
+
+			/**
+			 * Copy constructor (deleted).
+			 */
+			Topics(const Topics& other) = delete;
+
+			/**
+			 * Move constructor (deleted).
+			 */
+			Topics(Topics&& other) noexcept = delete;
+
+			/**
+			 * Destructor.
+			 */
+			~Topics() noexcept = default;
+
+			/**
+			 * Copy assignment (deleted).
+			 */
+			Topics& operator=(const Topics& other) = delete;
+
+			/**
+			 * Move assignment (deleted).
+			 */
+			Topics& operator=(Topics&& other) noexcept = delete;
+
+			/**
+			 * Subscribes a client to @p topic, creating its queue on first use.
+			 * @param topic Topic name.
+			 * @param id Client ID.
+			 * @param connection Client connection.
+			 * @param options Queue options for a new subscriber.
+			 * @return false if the client was already subscribed to @p topic.
+			 */
+			bool Subscribe(const std::string& topic, const ID& id, std::shared_ptr<Client> connection, const SubscriberOptions& options) noexcept;
+
+			/**
+			 * @param topic Topic name.
+			 * @param id Client ID.
+			 * @return false if the client was not subscribed to @p topic.
+			 */
+			bool Unsubscribe(const std::string& topic, const ID& id) noexcept;
+
+			/**
+			 * Drops every subscription of a client.
+			 * @param id Client ID.
+			 */
+			void Remove(const ID& id) noexcept;
+
+			/**
+			 * @param topic Topic name.
+			 * @return Current subscribers of @p topic (nullptr if none).
+			 */
+			std::shared_ptr<const SubscriberList> Subscribers(const std::string& topic) const noexcept;
+
+		private:
+			/**
+			 * @struct Entry
+			 * @brief A subscriber and the topics it follows.
+			 */
+			struct Entry {
+				std::shared_ptr<Subscriber> subscriber;		///< Publication queue
+				std::unordered_set<std::string> topics;		///< Subscribed topics
+			};
+
+			mutable std::shared_mutex m_mutex;													///< Protects both maps
+			std::unordered_map<std::string, std::shared_ptr<const SubscriberList>> m_topics;	///< Topic -> subscribers
+			std::unordered_map<ID, Entry> m_subscribers;										///< Client -> subscriptions
+
+			/**
+			 * Rebuilds the subscriber list of @p topic without @p id (caller holds the lock).
+			 * @param topic Topic name.
+			 * @param id Client ID.
+			 */
+			void Detach(const std::string& topic, const ID& id) noexcept;
+	};
+}
@@ -0,0 +1,38 @@
+#include <StormByte/network/executor/affinity.hxx>
+
+#ifdef LINUX
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#ifdef STORMBYTE_NETWORK_NUMA
+#include <numa.h>
+#endif
+
+using namespace StormByte::Network;
+
+bool Executor::PinCurrentThread(const std::vector<unsigned int>& cpus, const std::size_t& index) noexcept {
+	if (cpus.empty())
+		return false;
+
+#ifdef LINUX
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	CPU_SET(cpus[index % cpus.size()], &set);
+	return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+	(void)index;
+	return false;
+#endif
+}
+
+bool Executor::PreferLocalMemory() noexcept {
+#ifdef STORMBYTE_NETWORK_NUMA
+	if (numa_available() < 0)
+		return false;
+	numa_set_localalloc();
+	return true;
+#else
+	return false;
+#endif
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <StormByte/network/visibility.h>
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @namespace Executor
+ * @brief Shared worker pools used by the transport and server layers.
+ */
+namespace StormByte::Network::Executor {
+	/**
+	 * Pins the calling thread to one CPU of @p cpus.
+	 *
+	 * Best effort: an unavailable CPU or an unsupported platform (anything
+	 * but Linux) leaves the thread unpinned.
+	 * @param cpus CPU list (empty = do nothing).
+	 * @param index Thread index; the thread gets cpus[index % cpus.size()].
+	 * @return true if the thread was pinned.
+	 */
+	STORMBYTE_NETWORK_PRIVATE bool PinCurrentThread(const std::vector<unsigned int>& cpus, const std::size_t& index) noexcept;
+
+	/**
+	 * Makes the calling thread allocate new memory on its current NUMA node,
+	 * overriding an inherited interleave / bind policy. Call after pinning.
+	 *
+	 * Needs libnuma (STORMBYTE_NETWORK_NUMA); without it the kernel default
+	 * (first touch, usually local) applies.
+	 * @return true if the local policy was set.
+	 */
+	STORMBYTE_NETWORK_PRIVATE bool PreferLocalMemory() noexcept;
+}
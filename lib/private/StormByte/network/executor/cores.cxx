@@ -0,0 +1,37 @@
+#include <StormByte/network/executor/affinity.hxx>
+#include <StormByte/network/executor/cores.hxx>
+
+using namespace StormByte::Network::Executor;
+
+Cores::Cores(const Connection::ThreadPerCoreOptions& options) noexcept:
+	m_options(options),
+	m_load(std::make_unique<Counter[]>(options.cpus.size())) {}
+
+std::size_t Cores::Assign() noexcept {
+	std::size_t best = 0;
+	for (std::size_t core = 1; core < Size(); ++core) {
+		if (m_load[core].connections.load(std::memory_order_relaxed) < m_load[best].connections.load(std::memory_order_relaxed))
+			best = core;
+	}
+	m_load[best].connections.fetch_add(1, std::memory_order_relaxed);
+	return best;
+}
+
+void Cores::Release(const std::size_t& core) noexcept {
+	m_load[core].connections.fetch_sub(1, std::memory_order_relaxed);
+}
+
+bool Cores::Enter(const std::size_t& core) const noexcept {
+	const bool pinned = PinCurrentThread(m_options.cpus, core);
+	if (m_options.local_memory)
+		PreferLocalMemory();
+	return pinned;
+}
+
+std::vector<std::size_t> Cores::Load() const noexcept {
+	std::vector<std::size_t> load;
+	load.reserve(Size());
+	for (std::size_t core = 0; core < Size(); ++core)
+		load.push_back(m_load[core].connections.load(std::memory_order_relaxed));
+	return load;
+}
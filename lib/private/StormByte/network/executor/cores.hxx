@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <StormByte/network/connection/thread_per_core.hxx>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/**
+ * @namespace Executor
+ * @brief Shared worker pools used by the transport and server layers.
+ */
+namespace StormByte::Network::Executor {
+	/**
+	 * @class Cores
+	 * @brief Assigns connections to cores (thread-per-core mode).
+	 *
+	 * Keeps one connection counter per core, each on its own cache line, so
+	 * connection threads of different cores never write to shared lines.
+	 * Non-copyable / non-movable.
+	 */
+	class STORMBYTE_NETWORK_PRIVATE Cores final {
+		public:
+			/**
+			 * @param options Cores (must not be empty) and memory policy.
+			 */
+			explicit Cores(const Connection::ThreadPerCoreOptions& options) noexcept;
+
+			/**
+			 * Copy constructor (deleted).
+			 */
+			Cores(const Cores& other) = delete;
+
+			/**
+			 * Move constructor (deleted).
+			 */
+			Cores(Cores&& other) noexcept = delete;
+
+			/**
+			 * Destructor.
+			 */
+			~Cores() noexcept = default;
+
+			/**
+			 * Copy assignment (deleted).
+			 */
+			Cores& operator=(const Cores& other) = delete;
+
+			/**
+			 * Move assignment (deleted).
+			 */
+			Cores& operator=(Cores&& other) noexcept = delete;
+
+			/**
+			 * Picks the core with the fewest connections and counts one more.
+			 * @return Core index (into the configured CPU list).
+			 */
+			std::size_t Assign() noexcept;
+
+			/**
+			 * Counts one connection less on @p core.
+			 * @param core Core index from @ref Assign().
+			 */
+			void Release(const std::size_t& core) noexcept;
+
+			/**
+			 * Pins the calling thread to @p core and applies the memory policy.
+			 * @param core Core index from @ref Assign().
+			 * @return true if the thread was pinned.
+			 */
+			bool Enter(const std::size_t& core) const noexcept;
+
+			/**
+			 * @return Connections per core, in CPU list order.
+			 */
+			std::vector<std::size_t> Load() const noexcept;
+
+			/**
+			 * @return Number of cores.
+			 */
+			inline std::size_t Size() const noexcept {
+				return m_options.cpus.size();
+			}
+
+		private:
+			/**
+			 * @struct Counter
+			 * @brief Connection count of one core (own cache line).
+			 */
+			struct alignas(64) Counter {
+				std::atomic<std::size_t> connections { 0 };	///< Connections assigned
+			};
+
+			Connection::ThreadPerCoreOptions m_options;		///< Settings
+			std::unique_ptr<Counter[]> m_load;				///< One counter per core
+	};
+}
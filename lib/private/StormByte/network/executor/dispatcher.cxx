@@ -0,0 +1,104 @@
+#include <StormByte/network/executor/dispatcher.hxx>
+
+#include <algorithm>
+#include <numeric>
+
+using namespace StormByte::Network::Executor;
+
+Dispatcher::Dispatcher(const std::vector<Connection::HandlerClass>& classes) noexcept:
+	m_queues(classes.size()),
+	m_by_priority(classes.size()),
+	m_workers(),
+	m_stop(false) {
+	// Sized up front: queues hold move-only tasks and are never relocated
+	for (std::size_t i = 0; i < classes.size(); ++i)
+		m_queues[i].options = classes[i];
+
+	std::iota(m_by_priority.begin(), m_by_priority.end(), 0);
+	std::stable_sort(m_by_priority.begin(), m_by_priority.end(), [this](const std::size_t& a, const std::size_t& b) {
+		return m_queues[a].options.priority > m_queues[b].options.priority;
+	});
+
+	for (std::size_t handler_class = 0; handler_class < m_queues.size(); ++handler_class) {
+		for (std::size_t i = 0; i < std::max<std::size_t>(1, m_queues[handler_class].options.threads); ++i)
+			m_workers.emplace_back(&Dispatcher::Run, this, handler_class);
+	}
+}
+
+Dispatcher::~Dispatcher() noexcept {
+	{
+		std::scoped_lock lock(m_mutex);
+		m_stop = true;
+	}
+	m_cv.notify_all();
+	for (auto& worker : m_workers) {
+		if (worker.joinable())
+			worker.join();
+	}
+}
+
+void Dispatcher::Submit(const std::size_t& handler_class, const std::uint64_t& key, std::move_only_function<void()>&& task) noexcept {
+	{
+		std::scoped_lock lock(m_mutex);
+		if (m_stop)
+			return;
+
+		Queue& queue = m_queues[handler_class];
+		if (queue.options.ordered) {
+			auto [strand, idle] = queue.strands.try_emplace(key);
+			if (!idle) {
+				// The key's current task requeues this one when it finishes
+				strand->second.push_back(Task { .run = std::move(task), .key = key });
+				return;
+			}
+		}
+		queue.tasks.push_back(Task { .run = std::move(task), .key = key });
+	}
+	// Handlers of several classes share the condition variable
+	m_cv.notify_all();
+}
+
+std::size_t Dispatcher::Next(const std::size_t& handler_class) const noexcept {
+	const int priority = m_queues[handler_class].options.priority;
+	for (const std::size_t& candidate : m_by_priority) {
+		const Queue& queue = m_queues[candidate];
+		if (queue.options.priority < priority)
+			break;
+		if (!queue.tasks.empty() && (candidate == handler_class || queue.options.priority > priority))
+			return candidate;
+	}
+	return m_queues.size();
+}
+
+void Dispatcher::Run(const std::size_t handler_class) noexcept {
+	std::unique_lock lock(m_mutex);
+	while (true) {
+		std::size_t source = m_queues.size();
+		m_cv.wait(lock, [this, &handler_class, &source] {
+			return m_stop || (source = Next(handler_class)) < m_queues.size();
+		});
+		if (m_stop)
+			return;
+
+		Task task = std::move(m_queues[source].tasks.front());
+		m_queues[source].tasks.pop_front();
+		lock.unlock();
+		task.run();
+		task.run = nullptr;
+		lock.lock();
+
+		Queue& queue = m_queues[source];
+		if (queue.options.ordered) {
+			auto strand = queue.strands.find(task.key);
+			if (strand->second.empty())
+				queue.strands.erase(strand);
+			else {
+				queue.tasks.push_back(std::move(strand->second.front()));
+				strand->second.pop_front();
+				lock.unlock();
+				m_cv.notify_all();
+				lock.lock();
+			}
+		}
+	}
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <StormByte/network/connection/dispatch.hxx>
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @namespace Executor
+ * @brief Shared worker pools used by the transport and server layers.
+ */
+namespace StormByte::Network::Executor {
+	/**
+	 * @class Dispatcher
+	 * @brief Prioritized task queues, one per Connection::HandlerClass, each
+	 * with its own threads.
+	 *
+	 * Tasks of ordered classes are serialized per key (connection): while one
+	 * runs, later ones with the same key wait in a strand instead of the
+	 * class queue, so they never occupy a thread. Non-copyable / non-movable.
+	 */
+	class STORMBYTE_NETWORK_PRIVATE Dispatcher final {
+		public:
+			/**
+			 * @param classes Handler classes (index = class ID).
+			 */
+			explicit Dispatcher(const std::vector<Connection::HandlerClass>& classes) noexcept;
+
+			/**
+			 * Copy constructor (deleted).
+			 */
+			Dispatcher(const Dispatcher& other) = delete;
+
+			/**
+			 * Move constructor (deleted).
+			 */
+			Dispatcher(Dispatcher&& other) noexcept = delete;
+
+			/**
+			 * Destructor (drops queued tasks, waits for running ones).
+			 */
+			~Dispatcher() noexcept;
+
+			/**
+			 * Copy assignment (deleted).
+			 */
+			Dispatcher& operator=(const Dispatcher& other) = delete;
+
+			/**
+			 * Move assignment (deleted).
+			 */
+			Dispatcher& operator=(Dispatcher&& other) noexcept = delete;
+
+			/**
+			 * Queues @p task in @p handler_class.
+			 * @param handler_class Class index.
+			 * @param key Ordering key (connection); only used by ordered classes.
+			 * @param task Task to run.
+			 */
+			void Submit(const std::size_t& handler_class, const std::uint64_t& key, std::move_only_function<void()>&& task) noexcept;
+
+			/**
+			 * @return Number of handler classes.
+			 */
+			inline std::size_t Classes() const noexcept {
+				return m_queues.size();
+			}
+
+		private:
+			/**
+			 * @struct Task
+			 * @brief Queued task and its ordering key.
+			 */
+			struct Task {
+				std::move_only_function<void()> run;	///< Task body
+				std::uint64_t key;						///< Ordering key
+			};
+
+			/**
+			 * @struct Queue
+			 * @brief Pending tasks of one class.
+			 */
+			struct Queue {
+				Connection::HandlerClass options;										///< Class settings
+				std::deque<Task> tasks;													///< Runnable tasks
+				std::unordered_map<std::uint64_t, std::deque<Task>> strands;			///< Ordered: keys with a task queued or running, and their waiting tasks
+			};
+
+			std::vector<Queue> m_queues;				///< One queue per class
+			std::vector<std::size_t> m_by_priority;		///< Class indices, highest priority first
+			std::vector<std::thread> m_workers;			///< Handler threads
+			std::mutex m_mutex;							///< Protects the queues and m_stop
+			std::condition_variable m_cv;				///< Wakes idle handlers
+			bool m_stop;								///< Shutdown flag
+
+			/**
+			 * @param handler_class Class of the calling thread.
+			 * @return Highest-priority non-empty queue the thread may serve, or
+			 * m_queues.size() (caller holds m_mutex).
+			 */
+			std::size_t Next(const std::size_t& handler_class) const noexcept;
+
+			/**
+			 * Handler thread body.
+			 * @param handler_class Class the thread belongs to.
+			 */
+			void Run(const std::size_t handler_class) noexcept;
+	};
+}
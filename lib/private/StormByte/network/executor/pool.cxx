@@ -0,0 +1,85 @@
+#include <StormByte/network/executor/pool.hxx>
+
+#include <algorithm>
+#include <system_error>
+
+using namespace StormByte::Network::Executor;
+
+namespace {
+	thread_local const Pool* current_pool = nullptr;	///< Pool owning the calling worker (if any)
+}
+
+Pool::Pool(std::size_t threads) noexcept:
+	m_stop(false) {
+	if (threads == 0)
+		threads = std::max(2u, std::thread::hardware_concurrency());
+
+	m_workers.reserve(threads);
+	for (std::size_t i = 0; i < threads; ++i) {
+		try {
+			m_workers.emplace_back(&Pool::Run, this);
+		} catch (const std::system_error&) {
+			// Out of threads: run with the workers already started
+			break;
+		}
+	}
+}
+
+Pool::~Pool() noexcept {
+	{
+		std::scoped_lock lock(m_mutex);
+		m_stop = true;
+	}
+	m_cv.notify_all();
+
+	for (auto& worker : m_workers) {
+		if (worker.joinable())
+			worker.join();
+	}
+}
+
+Pool& Pool::Instance() noexcept {
+	static Pool instance(0);
+	return instance;
+}
+
+bool Pool::IsWorker() const noexcept {
+	return current_pool == this;
+}
+
+void Pool::Enqueue(std::move_only_function<void()>&& task) noexcept {
+	if (m_workers.empty()) {
+		task();
+		return;
+	}
+
+	{
+		std::unique_lock lock(m_mutex);
+		if (!m_stop) {
+			m_tasks.push_back(std::move(task));
+			lock.unlock();
+			m_cv.notify_one();
+			return;
+		}
+	}
+	// Workers may already be gone (e.g. static destruction): dropping the task would break its promise
+	task();
+}
+
+void Pool::Run() noexcept {
+	current_pool = this;
+
+	while (true) {
+		std::move_only_function<void()> task;
+		{
+			std::unique_lock lock(m_mutex);
+			m_cv.wait(lock, [this] { return m_stop || !m_tasks.empty(); });
+			// Drain what is already queued before honoring stop so no future is left unsatisfied
+			if (m_tasks.empty())
+				return;
+			task = std::move(m_tasks.front());
+			m_tasks.pop_front();
+		}
+		task();
+	}
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <StormByte/network/visibility.h>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @namespace Executor
+ * @brief Shared worker pools used by the transport and server layers.
+ */
+namespace StormByte::Network::Executor {
+	/**
+	 * @class Pool
+	 * @brief Fixed-size FIFO worker pool.
+	 *
+	 * Threads are created once and reused, so submitting work never spawns a
+	 * thread. @ref Instance() is the library-wide pool that runs frame pipelines.
+	 * Non-copyable / non-movable.
+	 */
+	class STORMBYTE_NETWORK_PRIVATE Pool final {
+		public:
+			/**
+			 * @param threads Worker count (0 = hardware concurrency). Fewer are
+			 * started if the system runs out of threads; with none at all,
+			 * tasks run inline on the submitting thread.
+			 */
+			explicit Pool(std::size_t threads) noexcept;
+
+			/**
+			 * Copy constructor (deleted).
+			 */
+			Pool(const Pool& other) = delete;
+
+			/**
+			 * Move constructor (deleted).
+			 */
+			Pool(Pool&& other) noexcept = delete;
+
+			/**
+			 * Destructor (drains queued tasks, joins workers).
+			 */
+			~Pool() noexcept;
+
+			/**
+			 * Copy assignment (deleted).
+			 */
+			Pool& operator=(const Pool& other) = delete;
+
+			/**
+			 * Move assignment (deleted).
+			 */
+			Pool& operator=(Pool&& other) noexcept = delete;
+
+			/**
+			 * @return Library-wide pool sized to the hardware concurrency.
+			 */
+			static Pool& Instance() noexcept;
+
+			/**
+			 * Queues @p task for execution on a worker. Submitted tasks are
+			 * never dropped: once the pool is stopping they run inline, so the
+			 * returned future is always satisfied.
+			 * @param task Callable with no arguments.
+			 * @return Future for the task result.
+			 */
+			template <typename F>
+			std::future<std::invoke_result_t<F>> Submit(F&& task) {
+				std::packaged_task<std::invoke_result_t<F>()> packaged(std::forward<F>(task));
+				auto future = packaged.get_future();
+				Enqueue([packaged = std::move(packaged)]() mutable { packaged(); });
+				return future;
+			}
+
+			/**
+			 * @return Number of worker threads.
+			 */
+			inline std::size_t Size() const noexcept {
+				return m_workers.size();
+			}
+
+			/**
+			 * @return true if the calling thread is one of this pool's workers.
+			 *
+			 * Callers that would block on a result from the same pool must run
+			 * the work inline instead, otherwise a saturated pool deadlocks.
+			 */
+			bool IsWorker() const noexcept;
+
+		private:
+			std::vector<std::thread> m_workers;					///< Worker threads
+			std::deque<std::move_only_function<void()>> m_tasks;	///< Pending tasks
+			std::mutex m_mutex;										///< Protects m_tasks / m_stop
+			std::condition_variable m_cv;							///< Wakes idle workers
+			bool m_stop;											///< Shutdown flag
+
+			/**
+			 * Pushes a type-erased task and wakes one worker (runs it inline
+			 * when no worker could be started or the pool is stopping).
+			 * @param task Task to run.
+			 */
+			void Enqueue(std::move_only_function<void()>&& task) noexcept;
+
+			/**
+			 * Worker thread body.
+			 */
+			void Run() noexcept;
+	};
+}
@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <StormByte/network/visibility.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <optional>
+
+/**
+ * @namespace Executor
+ * @brief Shared worker pools used by the transport and server layers.
+ */
+namespace StormByte::Network::Executor {
+	/**
+	 * @class Ring
+	 * @brief Bounded lock-free multi-producer / multi-consumer queue.
+	 *
+	 * Every cell carries a sequence number telling producers and consumers
+	 * whose turn it is, so a push or pop is one compare-and-swap on a shared
+	 * index plus a release store on the cell. The capacity is rounded up to
+	 * a power of two. Non-copyable / non-movable.
+	 * @tparam T Element type (movable).
+	 */
+	template<typename T>
+	class Ring final {
+		public:
+			/**
+			 * @param capacity Minimum number of elements (at least 2).
+			 */
+			explicit Ring(const std::size_t& capacity) noexcept:
+			m_mask(std::bit_ceil(std::max<std::size_t>(2, capacity)) - 1),
+			m_cells(std::make_unique<Cell[]>(m_mask + 1)),
+			m_head(0),
+			m_tail(0) {
+				for (std::size_t i = 0; i <= m_mask; ++i)
+					m_cells[i].sequence.store(i, std::memory_order_relaxed);
+			}
+
+			/**
+			 * Copy constructor (deleted).
+			 */
+			Ring(const Ring& other) = delete;
+
+			/**
+			 * Move constructor (deleted).
+			 */
+			Ring(Ring&& other) noexcept = delete;
+
+			/**
+			 * Destructor.
+			 */
+			~Ring() noexcept = default;
+
+			/**
+			 * Copy assignment (deleted).
+			 */
+			Ring& operator=(const Ring& other) = delete;
+
+			/**
+			 * Move assignment (deleted).
+			 */
+			Ring& operator=(Ring&& other) noexcept = delete;
+
+			/**
+			 * Appends @p value unless the ring is full.
+			 * @param value Element (only moved from on success).
+			 * @return false if full.
+			 */
+			bool Push(T& value) noexcept {
+				std::size_t position = m_tail.load(std::memory_order_relaxed);
+				while (true) {
+					Cell& cell = m_cells[position & m_mask];
+					const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+					const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+					if (diff == 0) {
+						if (m_tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+							cell.value = std::move(value);
+							cell.sequence.store(position + 1, std::memory_order_release);
+							return true;
+						}
+					}
+					else if (diff < 0)
+						return false;
+					else
+						position = m_tail.load(std::memory_order_relaxed);
+				}
+			}
+
+			/**
+			 * Removes the oldest element.
+			 * @return Element, or std::nullopt if empty.
+			 */
+			std::optional<T> Pop() noexcept {
+				std::size_t position = m_head.load(std::memory_order_relaxed);
+				while (true) {
+					Cell& cell = m_cells[position & m_mask];
+					const std::size_t sequence = cell.sequence.load(std::memory_order_acquire);
+					const std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1);
+					if (diff == 0) {
+						if (m_head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+							std::optional<T> value(std::move(cell.value));
+							cell.value = T();
+							cell.sequence.store(position + m_mask + 1, std::memory_order_release);
+							return value;
+						}
+					}
+					else if (diff < 0)
+						return std::nullopt;
+					else
+						position = m_head.load(std::memory_order_relaxed);
+				}
+			}
+
+			/**
+			 * @return Approximate number of queued elements.
+			 */
+			std::size_t Size() const noexcept {
+				const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+				const std::size_t head = m_head.load(std::memory_order_relaxed);
+				return tail > head ? tail - head : 0;
+			}
+
+			/**
+			 * @return Number of elements the ring holds.
+			 */
+			inline std::size_t Capacity() const noexcept {
+				return m_mask + 1;
+			}
+
+		private:
+			/**
+			 * @struct Cell
+			 * @brief One slot and the turn it is ready for.
+			 */
+			struct Cell {
+				std::atomic<std::size_t> sequence;	///< Position this cell is ready for (push: position, pop: position + 1)
+				T value;							///< Element
+			};
+
+			const std::size_t m_mask;						///< Capacity - 1
+			std::unique_ptr<Cell[]> m_cells;				///< Slots
+			alignas(64) std::atomic<std::size_t> m_head;	///< Next position to pop (own cache line)
+			alignas(64) std::atomic<std::size_t> m_tail;	///< Next position to push (own cache line)
+	};
+}
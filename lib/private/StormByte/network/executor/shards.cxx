@@ -0,0 +1,80 @@
+#include <StormByte/network/executor/affinity.hxx>
+#include <StormByte/network/executor/shards.hxx>
+
+#include <algorithm>
+#include <chrono>
+
+using namespace StormByte::Network::Executor;
+
+Shards::Shards(const Connection::ShardingOptions& options) noexcept:
+	m_options(options),
+	m_shards(),
+	m_stop(false) {
+	const std::size_t shards = std::max<std::size_t>(1, options.shards);
+	m_shards.reserve(shards);
+	for (std::size_t i = 0; i < shards; ++i)
+		m_shards.push_back(std::make_unique<Shard>(options.queue_capacity));
+	for (std::size_t i = 0; i < shards; ++i)
+		m_shards[i]->thread = std::thread(&Shards::Run, this, i);
+}
+
+Shards::~Shards() noexcept {
+	m_stop.store(true, std::memory_order_release);
+	for (auto& shard : m_shards) {
+		shard->signal.fetch_add(1, std::memory_order_release);
+		shard->signal.notify_one();
+		{
+			std::lock_guard<std::mutex> lock(shard->space_mutex);
+		}
+		shard->space.notify_all();
+	}
+	for (auto& shard : m_shards) {
+		if (shard->thread.joinable())
+			shard->thread.join();
+	}
+}
+
+bool Shards::Submit(const std::uint64_t& key, Task&& task, const std::function<bool()>& proceed) noexcept {
+	// Bounds the sleep so a sender notices when proceed turns false or a notify was missed
+	constexpr auto SLICE = std::chrono::milliseconds(10);
+	Shard& shard = *m_shards[key % m_shards.size()];
+	// A full shard makes its senders wait, so a hot key slows down its producers only
+	while (!shard.tasks.Push(task)) {
+		if (m_stop.load(std::memory_order_acquire) || (proceed && !proceed()))
+			return false;
+		std::unique_lock<std::mutex> lock(shard.space_mutex);
+		shard.waiting.fetch_add(1);
+		// Retried once registered: a pop in between either makes room for it or notifies
+		const bool pushed = shard.tasks.Push(task);
+		if (!pushed && !m_stop.load(std::memory_order_acquire))
+			shard.space.wait_for(lock, SLICE);
+		shard.waiting.fetch_sub(1);
+		if (pushed)
+			break;
+	}
+	shard.signal.fetch_add(1, std::memory_order_release);
+	shard.signal.notify_one();
+	return true;
+}
+
+void Shards::Run(const std::size_t index) noexcept {
+	PinCurrentThread(m_options.cpus, index);
+
+	Shard& shard = *m_shards[index];
+	while (!m_stop.load(std::memory_order_acquire)) {
+		const std::uint32_t seen = shard.signal.load(std::memory_order_acquire);
+		std::optional<Task> task = shard.tasks.Pop();
+		if (!task) {
+			shard.signal.wait(seen, std::memory_order_acquire);
+			continue;
+		}
+		if (shard.waiting.load() > 0) {
+			// Taking the lock orders this after a sender's retry, so its wait sees the notify
+			{
+				std::lock_guard<std::mutex> lock(shard.space_mutex);
+			}
+			shard.space.notify_one();
+		}
+		(*task)();
+	}
+}
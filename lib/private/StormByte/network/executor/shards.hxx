@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <StormByte/network/connection/sharding.hxx>
+#include <StormByte/network/executor/ring.hxx>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @namespace Executor
+ * @brief Shared worker pools used by the transport and server layers.
+ */
+namespace StormByte::Network::Executor {
+	/**
+	 * @class Shards
+	 * @brief Single-threaded task queues selected by key.
+	 *
+	 * Each shard is one thread draining its own bounded lock-free Ring, so
+	 * tasks with the same key run one at a time in submission order and
+	 * tasks with different keys may run in parallel. Non-copyable /
+	 * non-movable.
+	 */
+	class STORMBYTE_NETWORK_PRIVATE Shards final {
+		public:
+			using Task = std::move_only_function<void()>;	///< Unit of shard work
+
+			/**
+			 * @param options Shard count (at least 1), queue bound and CPU pinning.
+			 */
+			explicit Shards(const Connection::ShardingOptions& options) noexcept;
+
+			/**
+			 * Copy constructor (deleted).
+			 */
+			Shards(const Shards& other) = delete;
+
+			/**
+			 * Move constructor (deleted).
+			 */
+			Shards(Shards&& other) noexcept = delete;
+
+			/**
+			 * Destructor (drops queued tasks, waits for running ones).
+			 */
+			~Shards() noexcept;
+
+			/**
+			 * Copy assignment (deleted).
+			 */
+			Shards& operator=(const Shards& other) = delete;
+
+			/**
+			 * Move assignment (deleted).
+			 */
+			Shards& operator=(Shards&& other) noexcept = delete;
+
+			/**
+			 * Queues @p task on the shard of @p key, sleeping while it is full.
+			 * @param key Shard key.
+			 * @param task Task to run.
+			 * @param proceed Rechecked while waiting; returning false gives up
+			 * (empty = wait until there is room).
+			 * @return false if the shards are stopping or @p proceed gave up
+			 * (the task is dropped).
+			 */
+			bool Submit(const std::uint64_t& key, Task&& task, const std::function<bool()>& proceed = {}) noexcept;
+
+			/**
+			 * @return Number of shards.
+			 */
+			inline std::size_t Size() const noexcept {
+				return m_shards.size();
+			}
+
+		private:
+			/**
+			 * @struct Shard
+			 * @brief One shard thread and its queue.
+			 */
+			struct Shard {
+				Ring<Task> tasks;							///< Waiting tasks
+				std::atomic<std::uint32_t> signal { 0 };	///< Bumped on every push; the idle thread waits on it
+				std::atomic<std::uint32_t> waiting { 0 };	///< Senders waiting for room
+				std::mutex space_mutex;						///< Pairs with space
+				std::condition_variable space;				///< Notified on pop while senders wait
+				std::thread thread;							///< Shard thread
+
+				/**
+				 * @param capacity Queue capacity.
+				 */
+				explicit Shard(const std::size_t& capacity) noexcept:
+				tasks(capacity) {}
+			};
+
+			Connection::ShardingOptions m_options;				///< Settings
+			std::vector<std::unique_ptr<Shard>> m_shards;		///< Shards
+			std::atomic<bool> m_stop;							///< Shutdown flag
+
+			/**
+			 * Shard thread body.
+			 * @param index Shard index.
+			 */
+			void Run(const std::size_t index) noexcept;
+	};
+}
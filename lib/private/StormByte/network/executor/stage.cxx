@@ -0,0 +1,180 @@
+#include <StormByte/network/executor/affinity.hxx>
+#include <StormByte/network/executor/stage.hxx>
+
+#include <algorithm>
+
+using namespace StormByte::Network::Executor;
+
+namespace {
+	thread_local const Stage* current_stage = nullptr;	///< Stage owning the calling thread (if any)
+	thread_local std::size_t current_index = 0;			///< Worker index of the calling thread in current_stage
+}
+
+Stage::Stage(const Connection::StagingOptions& options) noexcept:
+	m_options(options),
+	m_ready(options.queue_capacity),
+	m_workers(),
+	m_signal(0),
+	m_stop(false) {
+	const std::size_t workers = std::max<std::size_t>(1, options.workers);
+	// Every deque exists before any thread may steal from it
+	m_workers.reserve(workers);
+	for (std::size_t i = 0; i < workers; ++i)
+		m_workers.push_back(std::make_unique<Worker>(options.queue_capacity));
+	for (std::size_t i = 0; i < workers; ++i)
+		m_workers[i]->thread = std::thread(&Stage::Run, this, i);
+}
+
+Stage::~Stage() noexcept {
+	m_stop.store(true, std::memory_order_release);
+	m_signal.fetch_add(1, std::memory_order_release);
+	m_signal.notify_all();
+	for (auto& worker : m_workers) {
+		if (worker->thread.joinable())
+			worker->thread.join();
+	}
+
+	// Queued lanes keep themselves alive; break that so their tasks are dropped
+	while (std::optional<Lane*> lane = m_ready.Pop())
+		lane.value()->m_self.reset();
+	for (auto& worker : m_workers) {
+		while (std::optional<Lane*> lane = worker->lanes.Pop())
+			lane.value()->m_self.reset();
+	}
+}
+
+std::shared_ptr<Lane> Stage::Open() const noexcept {
+	return std::make_shared<Lane>(m_options.lane_capacity);
+}
+
+bool Stage::Post(const std::shared_ptr<Lane>& lane, Task& task) noexcept {
+	if (m_stop.load(std::memory_order_acquire) || !lane->m_tasks.Push(task))
+		return false;
+
+	// Pairs with the fence in Drain(): either it sees this task or this sees the lane idle
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (!lane->m_scheduled.exchange(true, std::memory_order_acq_rel)) {
+		lane->m_self = lane;
+		Schedule(lane.get());
+	}
+	return true;
+}
+
+StormByte::Network::Connection::SchedulerStats Stage::Stats() const noexcept {
+	Connection::SchedulerStats stats;
+	stats.shared_depth = m_ready.Size();
+	stats.queue_depths.reserve(m_workers.size());
+	for (const auto& worker : m_workers) {
+		stats.executed += worker->executed.load(std::memory_order_relaxed);
+		stats.steals += worker->steals.load(std::memory_order_relaxed);
+		stats.queue_depths.push_back(worker->lanes.Size());
+	}
+	return stats;
+}
+
+void Stage::Schedule(Lane* lane) noexcept {
+	// Stage threads keep what they schedule; thieves take it if they fall behind
+	if (current_stage == this && m_workers[current_index]->lanes.Push(lane)) {
+		Wake();
+		return;
+	}
+
+	// A lane is queued at most once, so this only waits with more busy lanes than slots
+	while (!m_ready.Push(lane)) {
+		if (m_stop.load(std::memory_order_acquire)) {
+			lane->m_self.reset();
+			return;
+		}
+		std::this_thread::yield();
+	}
+	Wake();
+}
+
+void Stage::Wake() noexcept {
+	m_signal.fetch_add(1, std::memory_order_release);
+	m_signal.notify_one();
+}
+
+Lane* Stage::Next(const std::size_t& index) noexcept {
+	Worker& self = *m_workers[index];
+	if (std::optional<Lane*> lane = self.lanes.Pop())
+		return lane.value();
+
+	if (std::optional<Lane*> lane = m_ready.Pop()) {
+		// Take a few more along so idle threads find something to steal
+		std::size_t moved = 0;
+		while (moved < INJECT_BATCH - 1 && self.lanes.Size() <= m_options.queue_capacity / 2) {
+			std::optional<Lane*> more = m_ready.Pop();
+			if (!more || !self.lanes.Push(more.value())) {
+				if (more)
+					Schedule(more.value());
+				break;
+			}
+			++moved;
+		}
+		if (moved > 0)
+			Wake();
+		return lane.value();
+	}
+
+	for (std::size_t i = 1; i < m_workers.size(); ++i) {
+		Worker& victim = *m_workers[(index + i) % m_workers.size()];
+		if (std::optional<Lane*> lane = victim.lanes.Steal()) {
+			self.steals.fetch_add(1, std::memory_order_relaxed);
+			return lane.value();
+		}
+	}
+	return nullptr;
+}
+
+void Stage::Drain(const std::size_t& index, Lane* lane) noexcept {
+	Worker& self = *m_workers[index];
+	while (!m_stop.load(std::memory_order_acquire)) {
+		std::size_t ran = 0;
+		for (; ran < DRAIN_BATCH; ++ran) {
+			std::optional<Task> task = lane->m_tasks.Pop();
+			if (!task)
+				break;
+			self.executed.fetch_add(1, std::memory_order_relaxed);
+			(*task)();
+		}
+
+		if (ran == DRAIN_BATCH) {
+			// Turn used up: requeue behind other lanes, or keep going if the ring is full
+			if (m_ready.Push(lane)) {
+				Wake();
+				return;
+			}
+			continue;
+		}
+
+		// Released before the flag: a producer that then wins the flag sets it again
+		std::shared_ptr<Lane> keep = std::move(lane->m_self);
+		lane->m_scheduled.store(false, std::memory_order_release);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		// A task posted meanwhile may have found the lane still scheduled: reclaim it
+		if (lane->m_tasks.Size() == 0 || lane->m_scheduled.exchange(true, std::memory_order_acq_rel))
+			return;
+		lane->m_self = std::move(keep);
+	}
+
+	// Stopping: the lane is in no queue, so nothing else would release it
+	lane->m_self.reset();
+}
+
+void Stage::Run(const std::size_t index) noexcept {
+	current_stage = this;
+	current_index = index;
+
+	PinCurrentThread(m_options.cpus, index);
+
+	while (!m_stop.load(std::memory_order_acquire)) {
+		const std::uint32_t seen = m_signal.load(std::memory_order_acquire);
+		Lane* lane = Next(index);
+		if (!lane) {
+			m_signal.wait(seen, std::memory_order_acquire);
+			continue;
+		}
+		Drain(index, lane);
+	}
+}
@@ -0,0 +1,198 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <StormByte/network/connection/staging.hxx>
+#include <StormByte/network/executor/ring.hxx>
+#include <StormByte/network/executor/stealing_deque.hxx>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+/**
+ * @namespace Executor
+ * @brief Shared worker pools used by the transport and server layers.
+ */
+namespace StormByte::Network::Executor {
+	/**
+	 * @class Lane
+	 * @brief Ordered Stage task queue of one producer (a connection's thread).
+	 */
+	class STORMBYTE_NETWORK_PRIVATE Lane final {
+		public:
+			/**
+			 * @param capacity Tasks the lane holds.
+			 */
+			explicit Lane(const std::size_t& capacity) noexcept:
+			m_tasks(capacity),
+			m_scheduled(false),
+			m_self() {}
+
+			/**
+			 * @return Approximate number of waiting tasks.
+			 */
+			inline std::size_t Pending() const noexcept {
+				return m_tasks.Size();
+			}
+
+		private:
+			friend class Stage;
+
+			Ring<std::move_only_function<void()>> m_tasks;	///< Waiting tasks
+			std::atomic<bool> m_scheduled;					///< Queued on (or being drained from) a stage queue
+			std::shared_ptr<Lane> m_self;					///< Keeps the lane alive while queued (set by the m_scheduled owner)
+	};
+
+	/**
+	 * @class Stage
+	 * @brief Bounded work-stealing pool running the CPU side of request
+	 * handling.
+	 *
+	 * Work is posted to a Lane (one per connection). A lane with tasks is
+	 * scheduled once and drained by one stage thread at a time, so tasks of
+	 * a lane run in order and never concurrently. Lanes scheduled by other
+	 * threads go to a shared lock-free ring; stage threads move batches of
+	 * them into their own StealingDeque, pop from it newest first and, when
+	 * idle, steal the oldest lanes of other threads. Idle threads sleep on
+	 * an atomic counter. Non-copyable / non-movable.
+	 */
+	class STORMBYTE_NETWORK_PRIVATE Stage final {
+		public:
+			using Task = std::move_only_function<void()>;	///< Unit of stage work
+
+			/**
+			 * @param options Thread count, queue bounds and CPU pinning.
+			 */
+			explicit Stage(const Connection::StagingOptions& options) noexcept;
+
+			/**
+			 * Copy constructor (deleted).
+			 */
+			Stage(const Stage& other) = delete;
+
+			/**
+			 * Move constructor (deleted).
+			 */
+			Stage(Stage&& other) noexcept = delete;
+
+			/**
+			 * Destructor (drops queued tasks, waits for running ones).
+			 */
+			~Stage() noexcept;
+
+			/**
+			 * Copy assignment (deleted).
+			 */
+			Stage& operator=(const Stage& other) = delete;
+
+			/**
+			 * Move assignment (deleted).
+			 */
+			Stage& operator=(Stage&& other) noexcept = delete;
+
+			/**
+			 * @return A new, empty lane.
+			 */
+			std::shared_ptr<Lane> Open() const noexcept;
+
+			/**
+			 * Queues @p task on @p lane. Only one thread may post to a lane.
+			 * @param lane Lane from @ref Open().
+			 * @param task Task (left untouched when the lane is full).
+			 * @return false if the lane is full or the stage is stopping.
+			 */
+			bool Post(const std::shared_ptr<Lane>& lane, Task& task) noexcept;
+
+			/**
+			 * @return Number of stage threads.
+			 */
+			inline std::size_t Workers() const noexcept {
+				return m_workers.size();
+			}
+
+			/**
+			 * @return Scheduler counters and current queue depths.
+			 */
+			Connection::SchedulerStats Stats() const noexcept;
+
+		private:
+			static constexpr std::size_t DRAIN_BATCH = 16;		///< Tasks run from a lane before it yields to others
+			static constexpr std::size_t INJECT_BATCH = 8;		///< Lanes moved from the shared ring to a thread's deque at once
+
+			/**
+			 * @struct Worker
+			 * @brief One stage thread and its ready lanes.
+			 */
+			struct Worker {
+				StealingDeque<Lane*> lanes;					///< Ready lanes (owner pops newest, thieves steal oldest)
+				std::atomic<std::uint64_t> executed { 0 };	///< Tasks started
+				std::atomic<std::uint64_t> steals { 0 };	///< Lanes stolen from other workers
+				std::thread thread;							///< Stage thread
+
+				/**
+				 * @param capacity Deque capacity.
+				 */
+				explicit Worker(const std::size_t& capacity) noexcept:
+				lanes(capacity) {}
+			};
+
+			Connection::StagingOptions m_options;				///< Settings
+			Ring<Lane*> m_ready;								///< Lanes scheduled from outside the stage
+			std::vector<std::unique_ptr<Worker>> m_workers;	///< Stage threads
+			std::atomic<std::uint32_t> m_signal;				///< Bumped whenever a lane becomes ready; idle threads wait on it
+			std::atomic<bool> m_stop;							///< Shutdown flag
+
+			/**
+			 * Queues @p lane (own deque on a stage thread, shared ring
+			 * otherwise) and wakes a thread.
+			 * @param lane Lane whose m_scheduled flag and m_self the caller just set.
+			 */
+			void Schedule(Lane* lane) noexcept;
+
+			/**
+			 * Wakes one idle thread.
+			 */
+			void Wake() noexcept;
+
+			/**
+			 * Finds the next lane for @p index: own deque, then the shared
+			 * ring, then other threads' deques.
+			 * @param index Worker index.
+			 * @return Lane, or nullptr if there is no work.
+			 */
+			Lane* Next(const std::size_t& index) noexcept;
+
+			/**
+			 * Runs tasks of @p lane until it is empty or has used its turn.
+			 * @param index Worker index.
+			 * @param lane Lane taken from a queue.
+			 */
+			void Drain(const std::size_t& index, Lane* lane) noexcept;
+
+			/**
+			 * Stage thread body.
+			 * @param index Worker index.
+			 */
+			void Run(const std::size_t index) noexcept;
+	};
+}
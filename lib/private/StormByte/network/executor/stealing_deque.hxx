@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <StormByte/network/visibility.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+/**
+ * @namespace Executor
+ * @brief Shared worker pools used by the transport and server layers.
+ */
+namespace StormByte::Network::Executor {
+	/**
+	 * @class StealingDeque
+	 * @brief Bounded Chase-Lev work-stealing deque.
+	 *
+	 * The owning thread pushes and pops at the bottom (LIFO, so it keeps
+	 * working on what it touched last); any other thread steals from the
+	 * top (FIFO, taking the oldest work). Only the last element needs a
+	 * compare-and-swap between owner and thieves. The capacity is rounded
+	 * up to a power of two. Non-copyable / non-movable.
+	 * @tparam T Element type (trivially copyable, e.g. a pointer).
+	 */
+	template<typename T>
+	class StealingDeque final {
+		static_assert(std::is_trivially_copyable_v<T>, "StealingDeque elements must be trivially copyable");
+
+		public:
+			/**
+			 * @param capacity Minimum number of elements (at least 2).
+			 */
+			explicit StealingDeque(const std::size_t& capacity) noexcept:
+			m_mask(std::bit_ceil(std::max<std::size_t>(2, capacity)) - 1),
+			m_cells(std::make_unique<std::atomic<T>[]>(m_mask + 1)),
+			m_top(0),
+			m_bottom(0) {}
+
+			/**
+			 * Copy constructor (deleted).
+			 */
+			StealingDeque(const StealingDeque& other) = delete;
+
+			/**
+			 * Move constructor (deleted).
+			 */
+			StealingDeque(StealingDeque&& other) noexcept = delete;
+
+			/**
+			 * Destructor.
+			 */
+			~StealingDeque() noexcept = default;
+
+			/**
+			 * Copy assignment (deleted).
+			 */
+			StealingDeque& operator=(const StealingDeque& other) = delete;
+
+			/**
+			 * Move assignment (deleted).
+			 */
+			StealingDeque& operator=(StealingDeque&& other) noexcept = delete;
+
+			/**
+			 * Adds @p value at the bottom (owner only).
+			 * @param value Element.
+			 * @return false if full.
+			 */
+			bool Push(const T& value) noexcept {
+				const std::int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+				const std::int64_t top = m_top.load(std::memory_order_acquire);
+				if (bottom - top > static_cast<std::int64_t>(m_mask))
+					return false;
+				m_cells[bottom & m_mask].store(value, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_release);
+				m_bottom.store(bottom + 1, std::memory_order_relaxed);
+				return true;
+			}
+
+			/**
+			 * Takes the newest element (owner only).
+			 * @return Element, or std::nullopt if empty.
+			 */
+			std::optional<T> Pop() noexcept {
+				const std::int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+				m_bottom.store(bottom, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				std::int64_t top = m_top.load(std::memory_order_relaxed);
+
+				if (top > bottom) {
+					m_bottom.store(bottom + 1, std::memory_order_relaxed);
+					return std::nullopt;
+				}
+
+				const T value = m_cells[bottom & m_mask].load(std::memory_order_relaxed);
+				if (top == bottom) {
+					// Last element: race the thieves for it
+					const bool won = m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+					m_bottom.store(bottom + 1, std::memory_order_relaxed);
+					if (!won)
+						return std::nullopt;
+				}
+				return value;
+			}
+
+			/**
+			 * Takes the oldest element (any thread).
+			 * @return Element, or std::nullopt if empty or lost to another thread.
+			 */
+			std::optional<T> Steal() noexcept {
+				std::int64_t top = m_top.load(std::memory_order_acquire);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				const std::int64_t bottom = m_bottom.load(std::memory_order_acquire);
+				if (top >= bottom)
+					return std::nullopt;
+
+				const T value = m_cells[top & m_mask].load(std::memory_order_relaxed);
+				if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+					return std::nullopt;
+				return value;
+			}
+
+			/**
+			 * @return Approximate number of elements.
+			 */
+			std::size_t Size() const noexcept {
+				const std::int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+				const std::int64_t top = m_top.load(std::memory_order_relaxed);
+				return bottom > top ? static_cast<std::size_t>(bottom - top) : 0;
+			}
+
+		private:
+			const std::size_t m_mask;							///< Capacity - 1
+			std::unique_ptr<std::atomic<T>[]> m_cells;			///< Slots
+			alignas(64) std::atomic<std::int64_t> m_top;		///< Next position to steal (own cache line)
+			alignas(64) std::atomic<std::int64_t> m_bottom;	///< Next position to push (own cache line)
+	};
+}
@@ -0,0 +1,217 @@
+#include <StormByte/network/executor/timer_wheel.hxx>
+
+#include <algorithm>
+#include <utility>
+
+using namespace StormByte::Network::Executor;
+
+namespace {
+	constexpr std::uint64_t SLOT_MASK = 0xFF;					///< Slot index within a level
+	constexpr std::uint64_t MAX_TICKS = (std::uint64_t { 1 } << 32) - (std::uint64_t { 1 } << 24);	///< Furthest expiry the top level holds
+
+	/**
+	 * @param generation Node generation.
+	 * @param index Slab index.
+	 * @return Timer handle.
+	 */
+	constexpr TimerWheel::TimerID Handle(const std::uint32_t& generation, const std::uint32_t& index) noexcept {
+		return (static_cast<std::uint64_t>(generation) << 32) | index;
+	}
+}
+
+TimerWheel::TimerWheel() noexcept:
+	m_armed(0),
+	m_tick(0),
+	m_now(0),
+	m_firing(0),
+	m_stop(false),
+	m_epoch(std::chrono::steady_clock::now()) {
+	m_slots.fill(NONE);
+	m_thread = std::thread(&TimerWheel::Run, this);
+}
+
+TimerWheel::~TimerWheel() noexcept {
+	{
+		std::scoped_lock lock(m_mutex);
+		m_stop = true;
+	}
+	m_cv.notify_all();
+	if (m_thread.joinable())
+		m_thread.join();
+}
+
+TimerWheel& TimerWheel::Instance() noexcept {
+	static TimerWheel instance;
+	return instance;
+}
+
+TimerWheel::TimerID TimerWheel::Schedule(const std::chrono::milliseconds& delay, std::move_only_function<void()>&& callback) noexcept {
+	std::scoped_lock lock(m_mutex);
+	if (m_stop)
+		return 0;
+
+	if (m_armed == 0) {
+		// Nothing is linked, so the idle wheel may jump to the present
+		m_tick = std::max(m_tick, Elapsed());
+		m_now.store(m_tick, std::memory_order_relaxed);
+	}
+
+	std::uint32_t index;
+	if (!m_free.empty()) {
+		index = m_free.back();
+		m_free.pop_back();
+	} else {
+		index = static_cast<std::uint32_t>(m_nodes.size());
+		m_nodes.emplace_back();
+	}
+
+	Node& node = m_nodes[index];
+	node.callback = std::move(callback);
+	node.expiry = std::clamp(ExpiryTick(delay), m_tick + 1, m_tick + MAX_TICKS);
+	Link(index);
+
+	if (++m_armed == 1)
+		m_cv.notify_all();
+	return Handle(node.generation, index);
+}
+
+bool TimerWheel::Cancel(const TimerID& timer) noexcept {
+	if (timer == 0)
+		return false;
+
+	const std::uint32_t index = static_cast<std::uint32_t>(timer);
+	const std::uint32_t generation = static_cast<std::uint32_t>(timer >> 32);
+	std::move_only_function<void()> callback;
+	{
+		std::unique_lock lock(m_mutex);
+		if (index < m_nodes.size() && m_nodes[index].generation == generation && m_nodes[index].slot != NONE) {
+			Unlink(index);
+			callback = Release(index);
+			--m_armed;
+			return true;
+		}
+
+		// A callback cancelling its own timer must not wait for itself
+		if (std::this_thread::get_id() != m_thread.get_id())
+			m_cv.wait(lock, [this, &timer] { return m_firing != timer; });
+	}
+	return false;
+}
+
+std::uint64_t TimerWheel::ExpiryTick(const std::chrono::milliseconds& delay) const noexcept {
+	const auto due = std::chrono::steady_clock::now() - m_epoch + delay;
+	return static_cast<std::uint64_t>((due + TICK - std::chrono::nanoseconds(1)) / TICK);
+}
+
+std::uint64_t TimerWheel::Elapsed() const noexcept {
+	return static_cast<std::uint64_t>((std::chrono::steady_clock::now() - m_epoch) / TICK);
+}
+
+void TimerWheel::Link(const std::uint32_t& index) noexcept {
+	Node& node = m_nodes[index];
+	const std::uint64_t delta = node.expiry - m_tick;
+
+	std::size_t level = 0;
+	while (level + 1 < LEVELS && delta >= (std::uint64_t { 1 } << (SLOT_BITS * (level + 1))))
+		++level;
+
+	node.slot = static_cast<std::uint32_t>(level * SLOTS + ((node.expiry >> (SLOT_BITS * level)) & SLOT_MASK));
+	node.prev = NONE;
+	node.next = m_slots[node.slot];
+	if (node.next != NONE)
+		m_nodes[node.next].prev = index;
+	m_slots[node.slot] = index;
+}
+
+void TimerWheel::Unlink(const std::uint32_t& index) noexcept {
+	Node& node = m_nodes[index];
+	if (node.prev != NONE)
+		m_nodes[node.prev].next = node.next;
+	else
+		m_slots[node.slot] = node.next;
+	if (node.next != NONE)
+		m_nodes[node.next].prev = node.prev;
+	node.prev = node.next = node.slot = NONE;
+}
+
+std::move_only_function<void()> TimerWheel::Release(const std::uint32_t& index) noexcept {
+	Node& node = m_nodes[index];
+	std::move_only_function<void()> callback = std::move(node.callback);
+	node.callback = nullptr;
+	++node.generation;
+	if (node.generation == 0)
+		node.generation = 1;
+	m_free.push_back(index);
+	return callback;
+}
+
+void TimerWheel::Cascade(const std::size_t& level, const std::size_t& slot) noexcept {
+	std::uint32_t index = std::exchange(m_slots[level * SLOTS + slot], NONE);
+	while (index != NONE) {
+		const std::uint32_t next = m_nodes[index].next;
+		Link(index);
+		index = next;
+	}
+}
+
+void TimerWheel::Run() noexcept {
+	std::unique_lock lock(m_mutex);
+	while (!m_stop) {
+		if (m_armed == 0) {
+			m_cv.wait(lock, [this] { return m_stop || m_armed > 0; });
+			continue;
+		}
+		if (m_tick >= Elapsed()) {
+			m_cv.wait_until(lock, m_epoch + (m_tick + 1) * TICK);
+			continue;
+		}
+
+		++m_tick;
+		m_now.store(m_tick, std::memory_order_relaxed);
+
+		// A level's slot comes due when every lower level wraps around
+		for (std::size_t level = 1; level < LEVELS; ++level) {
+			if ((m_tick & ((std::uint64_t { 1 } << (SLOT_BITS * level)) - 1)) != 0)
+				break;
+			Cascade(level, (m_tick >> (SLOT_BITS * level)) & SLOT_MASK);
+		}
+
+		// Schedule() only moves an empty wheel's tick, which ends this slot too
+		const std::uint64_t tick = m_tick;
+		const std::size_t due = tick & SLOT_MASK;
+		while (!m_stop && m_tick == tick && m_slots[due] != NONE) {
+			const std::uint32_t index = m_slots[due];
+			const TimerID timer = Handle(m_nodes[index].generation, index);
+			Unlink(index);
+			std::move_only_function<void()> callback = Release(index);
+			--m_armed;
+
+			m_firing = timer;
+			lock.unlock();
+			callback();
+			callback = nullptr;
+			lock.lock();
+			m_firing = 0;
+			m_cv.notify_all();
+		}
+	}
+}
+
+Deadline::Deadline(const std::chrono::milliseconds& delay, std::move_only_function<void()>&& on_expiry) noexcept:
+	m_expired(false),
+	m_on_expiry(std::move(on_expiry)),
+	m_timer(0) {
+	if (delay.count() > 0) {
+		m_timer = TimerWheel::Instance().Schedule(delay, [this] {
+			m_expired.store(true, std::memory_order_release);
+			if (m_on_expiry)
+				m_on_expiry();
+		});
+	}
+}
+
+Deadline::~Deadline() noexcept {
+	// Waits for a running expiry callback, which uses this object
+	if (m_timer != 0)
+		TimerWheel::Instance().Cancel(m_timer);
+}
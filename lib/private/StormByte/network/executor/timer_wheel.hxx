@@ -0,0 +1,246 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <StormByte/network/typedefs.hxx>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @namespace Executor
+ * @brief Shared worker pools used by the transport and server layers.
+ */
+namespace StormByte::Network::Executor {
+	/**
+	 * @class TimerWheel
+	 * @brief Hierarchical hashed timer wheel shared by every connection.
+	 *
+	 * Four levels of 256 slots at a 10 ms tick cover about 497 days; timers
+	 * further away are clamped. Scheduling and cancelling link / unlink a
+	 * node of a slab in O(1); a timer moves down a level at most three
+	 * times before it fires. One library thread advances the wheel while
+	 * timers are armed and sleeps otherwise.
+	 *
+	 * Callbacks run on the wheel thread and must not block: hand longer
+	 * work to Pool::Instance().
+	 * Non-copyable / non-movable.
+	 */
+	class STORMBYTE_NETWORK_PRIVATE TimerWheel final {
+		public:
+			using TimerID = std::uint64_t;								///< Timer handle (slot + generation, 0 = none)
+
+			static constexpr std::chrono::milliseconds TICK { 10 };	///< Wheel resolution
+
+			/**
+			 * Copy constructor (deleted).
+			 */
+			TimerWheel(const TimerWheel& other) = delete;
+
+			/**
+			 * Move constructor (deleted).
+			 */
+			TimerWheel(TimerWheel&& other) noexcept = delete;
+
+			/**
+			 * Destructor (stops the wheel thread; armed timers are dropped).
+			 */
+			~TimerWheel() noexcept;
+
+			/**
+			 * Copy assignment (deleted).
+			 */
+			TimerWheel& operator=(const TimerWheel& other) = delete;
+
+			/**
+			 * Move assignment (deleted).
+			 */
+			TimerWheel& operator=(TimerWheel&& other) noexcept = delete;
+
+			/**
+			 * @return Library-wide wheel.
+			 */
+			static TimerWheel& Instance() noexcept;
+
+			/**
+			 * Runs @p callback once @p delay has passed (rounded up to the next tick).
+			 * @param delay Delay.
+			 * @param callback One-shot callback (runs on the wheel thread).
+			 * @return Timer handle (0 if the wheel is stopping).
+			 */
+			TimerID Schedule(const std::chrono::milliseconds& delay, std::move_only_function<void()>&& callback) noexcept;
+
+			/**
+			 * Disarms @p timer. If its callback is running on another thread,
+			 * waits for it to return, so nothing it captured is used afterwards.
+			 * @param timer Handle from @ref Schedule() (stale handles are ignored).
+			 * @return true if the timer was disarmed before firing.
+			 */
+			bool Cancel(const TimerID& timer) noexcept;
+
+			/**
+			 * Coarse clock read without a system call; it only advances while
+			 * timers are armed.
+			 * @return Current tick.
+			 */
+			inline std::uint64_t Now() const noexcept {
+				return m_now.load(std::memory_order_relaxed);
+			}
+
+		private:
+			static constexpr std::size_t SLOT_BITS = 8;								///< Slot index bits per level
+			static constexpr std::size_t SLOTS = std::size_t { 1 } << SLOT_BITS;	///< Slots per level
+			static constexpr std::size_t LEVELS = 4;								///< Wheel levels
+			static constexpr std::uint32_t NONE = UINT32_MAX;						///< No node / not armed
+
+			/**
+			 * @struct Node
+			 * @brief Slab entry of one timer, linked into its slot.
+			 */
+			struct Node {
+				std::move_only_function<void()> callback;	///< Expiry callback
+				std::uint64_t expiry = 0;					///< Tick it fires at
+				std::uint32_t generation = 1;				///< Bumped on release (stale handles)
+				std::uint32_t prev = NONE;					///< Previous node in the slot
+				std::uint32_t next = NONE;					///< Next node in the slot
+				std::uint32_t slot = NONE;					///< Slot index (NONE = free)
+			};
+
+			mutable std::mutex m_mutex;					///< Protects the wheel
+			std::condition_variable m_cv;				///< Wakes the thread / cancelling threads
+			std::vector<Node> m_nodes;					///< Timer slab
+			std::vector<std::uint32_t> m_free;			///< Free slab entries
+			std::array<std::uint32_t, LEVELS * SLOTS> m_slots;	///< Slot list heads
+			std::size_t m_armed;						///< Timers linked into slots
+			std::uint64_t m_tick;						///< Last processed tick
+			std::atomic<std::uint64_t> m_now;			///< m_tick for lock-free readers
+			TimerID m_firing;							///< Timer whose callback is running (0 = none)
+			bool m_stop;								///< Shutdown flag
+			std::chrono::steady_clock::time_point m_epoch;	///< Tick 0
+			std::thread m_thread;						///< Wheel thread
+
+			/**
+			 * Starts the wheel thread.
+			 */
+			TimerWheel() noexcept;
+
+			/**
+			 * @param delay Delay from now.
+			 * @return First tick at or after now + @p delay.
+			 */
+			std::uint64_t ExpiryTick(const std::chrono::milliseconds& delay) const noexcept;
+
+			/**
+			 * @return Ticks elapsed since @ref m_epoch.
+			 */
+			std::uint64_t Elapsed() const noexcept;
+
+			/**
+			 * Links node @p index into the slot of its expiry, relative to @ref m_tick.
+			 * @param index Slab index.
+			 */
+			void Link(const std::uint32_t& index) noexcept;
+
+			/**
+			 * Unlinks node @p index from its slot.
+			 * @param index Slab index.
+			 */
+			void Unlink(const std::uint32_t& index) noexcept;
+
+			/**
+			 * Returns node @p index to the slab, invalidating its handle.
+			 * @param index Slab index.
+			 * @return Its callback (destroyed by the caller, outside the lock).
+			 */
+			std::move_only_function<void()> Release(const std::uint32_t& index) noexcept;
+
+			/**
+			 * Re-links every timer of one slot into lower levels.
+			 * @param level Wheel level (1 or above).
+			 * @param slot Slot index within the level.
+			 */
+			void Cascade(const std::size_t& level, const std::size_t& slot) noexcept;
+
+			/**
+			 * Wheel thread body.
+			 */
+			void Run() noexcept;
+	};
+
+	/**
+	 * @class Deadline
+	 * @brief Scoped timer on TimerWheel::Instance().
+	 *
+	 * Arms on construction and disarms on destruction, so code waiting on
+	 * I/O checks a flag instead of reading the clock.
+	 * Non-copyable / non-movable.
+	 */
+	class STORMBYTE_NETWORK_PRIVATE Deadline final {
+		public:
+			/**
+			 * @param delay Time limit (zero = never expires).
+			 * @param on_expiry Optional callback run on expiry (on the wheel thread).
+			 */
+			explicit Deadline(const std::chrono::milliseconds& delay, std::move_only_function<void()>&& on_expiry = {}) noexcept;
+
+			/**
+			 * Copy constructor (deleted).
+			 */
+			Deadline(const Deadline& other) = delete;
+
+			/**
+			 * Move constructor (deleted).
+			 */
+			Deadline(Deadline&& other) noexcept = delete;
+
+			/**
+			 * Destructor (disarms the timer).
+			 */
+			~Deadline() noexcept;
+
+			/**
+			 * Copy assignment (deleted).
+			 */
+			Deadline& operator=(const Deadline& other) = delete;
+
+			/**
+			 * Move assignment (deleted).
+			 */
+			Deadline& operator=(Deadline&& other) noexcept = delete;
+
+			/**
+			 * @return true once the time limit has passed.
+			 */
+			inline bool Expired() const noexcept {
+				return m_expired.load(std::memory_order_acquire);
+			}
+
+		private:
+			std::atomic<bool> m_expired;				///< Set by the timer
+			std::move_only_function<void()> m_on_expiry;	///< Expiry callback
+			TimerWheel::TimerID m_timer;				///< Armed timer (0 = none)
+	};
+}
@@ -0,0 +1,132 @@
+#include <StormByte/network/executor/pool.hxx>
+#include <StormByte/network/executor/write_poller.hxx>
+
+#ifdef UNIX
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#else
+#include <winsock2.h>
+#endif
+
+#include <chrono>
+
+using namespace StormByte::Network::Executor;
+
+namespace {
+#ifdef UNIX
+	using PollDescriptor = struct pollfd;	///< Native poll entry
+	constexpr int POLL_TIMEOUT_MS = -1;		///< The self-pipe wakes the thread
+#else
+	using PollDescriptor = WSAPOLLFD;		///< Native poll entry
+	constexpr int POLL_TIMEOUT_MS = 20;		///< No self-pipe: pick up new watchers periodically
+#endif
+}
+
+WritePoller::WritePoller() noexcept:
+	m_stop(false) {
+	// Callbacks run on the shared pool: make sure it outlives this poller
+	(void)Pool::Instance();
+#ifdef UNIX
+	if (::pipe(m_wake) == 0) {
+		::fcntl(m_wake[0], F_SETFL, ::fcntl(m_wake[0], F_GETFL) | O_NONBLOCK);
+		::fcntl(m_wake[1], F_SETFL, ::fcntl(m_wake[1], F_GETFL) | O_NONBLOCK);
+	} else {
+		m_wake[0] = m_wake[1] = -1;
+	}
+#endif
+	m_thread = std::thread(&WritePoller::Run, this);
+}
+
+WritePoller::~WritePoller() noexcept {
+	{
+		std::scoped_lock lock(m_mutex);
+		m_stop = true;
+	}
+	Wake();
+	if (m_thread.joinable())
+		m_thread.join();
+#ifdef UNIX
+	if (m_wake[0] >= 0) {
+		::close(m_wake[0]);
+		::close(m_wake[1]);
+	}
+#endif
+}
+
+WritePoller& WritePoller::Instance() noexcept {
+	static WritePoller instance;
+	return instance;
+}
+
+void WritePoller::Watch(const Connection::HandlerType& handle, std::move_only_function<void()>&& on_writable) noexcept {
+	{
+		std::scoped_lock lock(m_mutex);
+		m_pending.push_back(Watcher { .handle = handle, .callback = std::move(on_writable) });
+	}
+	Wake();
+}
+
+void WritePoller::Wake() noexcept {
+#ifdef UNIX
+	if (m_wake[1] >= 0) {
+		const char byte = 0;
+		(void)!::write(m_wake[1], &byte, 1);
+	}
+#endif
+}
+
+void WritePoller::Run() noexcept {
+	std::vector<Watcher> watching;
+	std::vector<PollDescriptor> descriptors;
+
+	while (true) {
+		{
+			std::scoped_lock lock(m_mutex);
+			if (m_stop)
+				return;
+			for (auto& watcher : m_pending)
+				watching.push_back(std::move(watcher));
+			m_pending.clear();
+		}
+
+		descriptors.clear();
+#ifdef UNIX
+		descriptors.push_back(PollDescriptor { .fd = m_wake[0], .events = POLLIN, .revents = 0 });
+#endif
+		for (const auto& watcher : watching)
+			descriptors.push_back(PollDescriptor { .fd = watcher.handle, .events = POLLOUT, .revents = 0 });
+
+#ifdef UNIX
+		const int ready = ::poll(descriptors.data(), descriptors.size(), POLL_TIMEOUT_MS);
+		constexpr std::size_t FIRST_WATCHER = 1;
+#else
+		const int ready = descriptors.empty()
+			? (std::this_thread::sleep_for(std::chrono::milliseconds(POLL_TIMEOUT_MS)), 0)
+			: ::WSAPoll(descriptors.data(), static_cast<ULONG>(descriptors.size()), POLL_TIMEOUT_MS);
+		constexpr std::size_t FIRST_WATCHER = 0;
+#endif
+		if (ready <= 0)
+			continue;
+
+#ifdef UNIX
+		if (descriptors[0].revents & POLLIN) {
+			char drain[64];
+			while (::read(m_wake[0], drain, sizeof(drain)) > 0) {}
+		}
+#endif
+
+		// Any event (writable, hang-up, error, invalid handle) fires the callback
+		std::size_t kept = 0;
+		for (std::size_t i = 0; i < watching.size(); ++i) {
+			if (descriptors[FIRST_WATCHER + i].revents != 0) {
+				Pool::Instance().Submit(std::move(watching[i].callback));
+			} else {
+				if (kept != i)
+					watching[kept] = std::move(watching[i]);
+				++kept;
+			}
+		}
+		watching.resize(kept);
+	}
+}
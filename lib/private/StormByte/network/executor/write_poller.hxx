@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <StormByte/network/typedefs.hxx>
+
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @namespace Executor
+ * @brief Shared worker pools used by the transport and server layers.
+ */
+namespace StormByte::Network::Executor {
+	/**
+	 * @class WritePoller
+	 * @brief Single thread waiting for sockets to become writable.
+	 *
+	 * Connections whose send buffer is full register a one-shot callback
+	 * instead of blocking a thread on the socket; when the socket becomes
+	 * writable (or fails) the callback runs on Pool::Instance(). Every
+	 * waiting connection shares one poll() call.
+	 * Non-copyable / non-movable.
+	 */
+	class STORMBYTE_NETWORK_PRIVATE WritePoller final {
+		public:
+			/**
+			 * Copy constructor (deleted).
+			 */
+			WritePoller(const WritePoller& other) = delete;
+
+			/**
+			 * Move constructor (deleted).
+			 */
+			WritePoller(WritePoller&& other) noexcept = delete;
+
+			/**
+			 * Destructor (stops the poll thread; pending callbacks are dropped).
+			 */
+			~WritePoller() noexcept;
+
+			/**
+			 * Copy assignment (deleted).
+			 */
+			WritePoller& operator=(const WritePoller& other) = delete;
+
+			/**
+			 * Move assignment (deleted).
+			 */
+			WritePoller& operator=(WritePoller&& other) noexcept = delete;
+
+			/**
+			 * @return Library-wide poller.
+			 */
+			static WritePoller& Instance() noexcept;
+
+			/**
+			 * Runs @p on_writable once @p handle is writable, closed or failed.
+			 * @param handle Socket handle.
+			 * @param on_writable One-shot callback (runs on Pool::Instance()).
+			 */
+			void Watch(const Connection::HandlerType& handle, std::move_only_function<void()>&& on_writable) noexcept;
+
+		private:
+			/**
+			 * @struct Watcher
+			 * @brief Registered handle and its callback.
+			 */
+			struct Watcher {
+				Connection::HandlerType handle;				///< Socket handle
+				std::move_only_function<void()> callback;	///< Writability callback
+			};
+
+			std::mutex m_mutex;					///< Protects m_pending / m_stop
+			std::vector<Watcher> m_pending;		///< Registered since the last poll
+			bool m_stop;						///< Shutdown flag
+#ifdef UNIX
+			int m_wake[2];						///< Self-pipe interrupting poll()
+#endif
+			std::thread m_thread;				///< Poll thread
+
+			/**
+			 * Starts the poll thread.
+			 */
+			WritePoller() noexcept;
+
+			/**
+			 * Interrupts a running poll() so new watchers are picked up.
+			 */
+			void Wake() noexcept;
+
+			/**
+			 * Poll thread body.
+			 */
+			void Run() noexcept;
+	};
+}
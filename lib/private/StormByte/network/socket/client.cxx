@@ -14,10 +14,13 @@
 #endif
 
 #include <StormByte/network/connection/handler.hxx>
+#include <StormByte/network/executor/timer_wheel.hxx>
 #include <StormByte/system.hxx>
 #include <chrono>
 #include <cstring>
+#include <optional>
 #include <span>
+#include <system_error>
 #include <vector>
 
 constexpr std::size_t MAX_SINGLE_IO     = 4 * 1024 * 1024;
@@ -27,6 +30,78 @@ using namespace StormByte::Logger;
 using namespace StormByte::Network;
 
 namespace {
+#ifdef WINDOWS
+	using PollDescriptor = WSAPOLLFD;
+	constexpr Connection::HandlerType INVALID_HANDLE = INVALID_SOCKET;
+
+	int Poll(PollDescriptor* descriptors, std::size_t count, int timeout_ms) noexcept {
+		return ::WSAPoll(descriptors, static_cast<ULONG>(count), timeout_ms);
+	}
+
+	bool InProgress() noexcept {
+		return ::WSAGetLastError() == WSAEWOULDBLOCK;
+	}
+
+	bool Interrupted() noexcept {
+		return ::WSAGetLastError() == WSAEINTR;
+	}
+
+	bool MakeNonBlocking(Connection::HandlerType handle) noexcept {
+		u_long mode = 1;
+		return ::ioctlsocket(handle, FIONBIO, &mode) == 0;
+	}
+
+	void CloseHandle(Connection::HandlerType handle) noexcept {
+		::closesocket(handle);
+	}
+#else
+	using PollDescriptor = pollfd;
+	constexpr Connection::HandlerType INVALID_HANDLE = -1;
+
+	int Poll(PollDescriptor* descriptors, std::size_t count, int timeout_ms) noexcept {
+		return ::poll(descriptors, static_cast<nfds_t>(count), timeout_ms);
+	}
+
+	bool InProgress() noexcept {
+		return errno == EINPROGRESS;
+	}
+
+	bool Interrupted() noexcept {
+		return errno == EINTR;
+	}
+
+	bool MakeNonBlocking(Connection::HandlerType handle) noexcept {
+		const int flags = ::fcntl(handle, F_GETFL, 0);
+		return flags != -1 && ::fcntl(handle, F_SETFL, flags | O_NONBLOCK) == 0;
+	}
+
+	void CloseHandle(Connection::HandlerType handle) noexcept {
+		::close(handle);
+	}
+#endif
+
+	/**
+	 * Orders addresses for Happy Eyeballs (RFC 8305): alternates families,
+	 * starting with the resolver's first choice, keeping each family's order.
+	 * @param addresses Resolved addresses.
+	 * @return Attempt order.
+	 */
+	std::vector<Connection::Info> Interleave(std::vector<Connection::Info>&& addresses) noexcept {
+		std::vector<Connection::Info> first, second, ordered;
+		const Connection::Protocol preferred = addresses.front().Family();
+		for (Connection::Info& info: addresses)
+			(info.Family() == preferred ? first : second).push_back(std::move(info));
+
+		ordered.reserve(first.size() + second.size());
+		for (std::size_t i = 0; i < std::max(first.size(), second.size()); ++i) {
+			if (i < first.size())
+				ordered.push_back(std::move(first[i]));
+			if (i < second.size())
+				ordered.push_back(std::move(second[i]));
+		}
+		return ordered;
+	}
+
 	std::size_t ClampChunk(std::size_t preferred, std::size_t remaining) noexcept {
 		if (preferred == 0)
 			preferred = DEFAULT_IO_CHUNK;
@@ -39,10 +114,10 @@ namespace {
 
 Socket::Client::Client(const Connection::Protocol& protocol, std::shared_ptr<Logger::Log> logger) noexcept
 :Socket(protocol, logger) {
-	m_logger << Logger::Level::LowLevel << "Created client socket with UUID: " << m_UUID << std::endl;
+	m_logger << Logger::Level::LowLevel << "Created client socket" << std::endl;
 }
 
-ExpectedVoid Socket::Client::Connect(const std::string& hostname, const unsigned short& port) noexcept {
+ExpectedVoid Socket::Client::Connect(const std::string& hostname, const unsigned short& port, const Connection::DialOptions& options) noexcept {
 	m_logger << Logger::Level::LowLevel << "Connecting to " << hostname << ":" << port << std::endl;
 
 	if (m_status.load(std::memory_order_acquire) != Connection::Status::Disconnected) {
@@ -51,37 +126,142 @@ ExpectedVoid Socket::Client::Connect(const std::string& hostname, const unsigned
 	}
 
 	m_status.store(Connection::Status::Connecting, std::memory_order_release);
+	(void)Connection::Handler::Instance();
+
+	// Resolving counts towards the dial timeout
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	const std::chrono::steady_clock::time_point deadline = options.timeout > 0
+		? start + std::chrono::milliseconds(options.timeout)
+		: std::chrono::steady_clock::time_point::max();
+	auto expected_infos = Connection::Info::Resolve(hostname, port, m_protocol, deadline);
+	if (!expected_infos) {
+		m_status.store(Connection::Status::Disconnected, std::memory_order_release);
+		m_logger << Logger::Level::Error << "Failed to resolve host: " << expected_infos.error()->what() << std::endl;
+		return Unexpected<ConnectionError>(expected_infos.error()->what());
+	}
 
-	auto expected_socket = CreateSocket();
-	if (!expected_socket) {
-		m_logger << Logger::Level::Error << "Failed to create socket: " << expected_socket.error()->what() << std::endl;
-		return Unexpected<ConnectionError>(expected_socket.error()->what());
+	auto expected_dial = Dial(Interleave(std::move(expected_infos.value())), start, options);
+	if (!expected_dial) {
+		m_status.store(Connection::Status::Disconnected, std::memory_order_release);
+		m_logger << Logger::Level::Error << "Failed to connect: " << expected_dial.error()->what() << std::endl;
+		return Unexpected(expected_dial.error());
 	}
 
-	m_handle = expected_socket.value();
+	InitializeAfterConnect();
 
-	auto expected_conn_info = Connection::Info::FromHost(hostname, port, m_protocol);
-	if (!expected_conn_info) {
-		m_logger << Logger::Level::Error << "Failed to resolve host: " << expected_conn_info.error()->what() << std::endl;
-		return Unexpected<ConnectionError>(expected_conn_info.error()->what());
-	}
+	m_logger << Logger::Level::LowLevel << "Successfully connected to " << hostname << ":" << port
+			<< " (" << m_conn_info->IP() << ")" << std::endl;
 
-	m_conn_info = std::make_unique<Connection::Info>(std::move(expected_conn_info.value()));
+	return {};
+}
 
-#ifdef WINDOWS
-	if (::connect(m_handle, m_conn_info->SockAddr().get(), sizeof(*m_conn_info->SockAddr())) == SOCKET_ERROR) {
-#else
-	if (::connect(m_handle, m_conn_info->SockAddr().get(), sizeof(*m_conn_info->SockAddr())) == -1) {
-#endif
-		m_logger << Logger::Level::Error << "Failed to connect: " << Connection::Handler::Instance().LastError() << std::endl;
-		return Unexpected<ConnectionError>(Connection::Handler::Instance().LastError());
-	}
+ExpectedVoid Socket::Client::Dial(std::vector<Connection::Info>&& addresses, const std::chrono::steady_clock::time_point& start, const Connection::DialOptions& options) noexcept {
+	using Clock = std::chrono::steady_clock;
 
-	InitializeAfterConnect();
+	struct Attempt {
+		Connection::HandlerType handle;
+		std::size_t address;
+	};
 
-	m_logger << Logger::Level::LowLevel << "Successfully connected to " << hostname << ":" << port << std::endl;
+	const Clock::time_point deadline = start + std::chrono::milliseconds(options.timeout);
+	const std::chrono::milliseconds attempt_delay(options.attempt_delay);
+	std::vector<Attempt> attempts;
+	std::vector<PollDescriptor> descriptors;
+	std::size_t next = 0;
+	Clock::time_point next_start = start;
+	std::string last_error = "no address to connect to";
+
+	auto close_all = [&attempts]() {
+		for (const Attempt& attempt: attempts)
+			CloseHandle(attempt.handle);
+		attempts.clear();
+	};
 
-	return {};
+	// Starts the next address that gets as far as an in-flight connect
+	auto launch = [&]() {
+		while (next < addresses.size()) {
+			const Connection::Info& info = addresses[next++];
+			Connection::HandlerType handle = ::socket(Connection::ProtocolInt(info.Family()), SOCK_STREAM, 0);
+			if (handle == INVALID_HANDLE) {
+				last_error = Connection::Handler::Instance().LastError();
+				continue;
+			}
+
+			m_logger << Logger::Level::LowLevel << "Trying " << info.IP() << ":" << info.Port() << std::endl;
+			if (MakeNonBlocking(handle) && (::connect(handle, info.SockAddr().get(), info.SockAddrSize()) == 0 || InProgress())) {
+				attempts.push_back({ handle, next - 1 });
+				return;
+			}
+
+			last_error = Connection::Handler::Instance().LastError();
+			CloseHandle(handle);
+		}
+	};
+
+	while (!attempts.empty() || next < addresses.size()) {
+		const Clock::time_point now = Clock::now();
+		if (options.timeout > 0 && now >= deadline) {
+			close_all();
+			return Unexpected<ConnectionError>("Connection timed out after {} ms", options.timeout);
+		}
+
+		if (attempts.empty() || (next < addresses.size() && now >= next_start)) {
+			launch();
+			next_start = now + attempt_delay;
+			continue;
+		}
+
+		// Sleep until an attempt settles, the next one is due or time is up
+		Clock::time_point wake = next < addresses.size() ? next_start : Clock::time_point::max();
+		if (options.timeout > 0)
+			wake = std::min(wake, deadline);
+		const int wait_ms = wake == Clock::time_point::max() ? -1 : static_cast<int>(
+			std::chrono::ceil<std::chrono::milliseconds>(wake - now).count());
+
+		descriptors.clear();
+		for (const Attempt& attempt: attempts)
+			descriptors.push_back({ attempt.handle, POLLOUT, 0 });
+
+		const int ready = Poll(descriptors.data(), descriptors.size(), wait_ms);
+		if (ready < 0) {
+			if (Interrupted())
+				continue;
+			last_error = Connection::Handler::Instance().LastError();
+			close_all();
+			break;
+		}
+
+		for (std::size_t i = descriptors.size(); i-- > 0;) {
+			if (descriptors[i].revents == 0)
+				continue;
+
+			int error = 0;
+			socklen_t length = sizeof(error);
+			if (::getsockopt(attempts[i].handle, SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&error), &length) != 0)
+				error = -1;
+
+			if (error == 0) {
+				const Attempt winner = attempts[i];
+				attempts.erase(attempts.begin() + i);
+				close_all();
+
+				m_handle = winner.handle;
+				m_conn_info = std::make_unique<Connection::Info>(std::move(addresses[winner.address]));
+				m_protocol = m_conn_info->Family();
+				return {};
+			}
+
+			last_error = error > 0 ? std::system_category().message(error) : Connection::Handler::Instance().LastError();
+			m_logger << Logger::Level::LowLevel << "Attempt to " << addresses[attempts[i].address].IP()
+					<< " failed: " << last_error << std::endl;
+			CloseHandle(attempts[i].handle);
+			attempts.erase(attempts.begin() + i);
+			// A failure hands over to the next address without waiting
+			next_start = now;
+		}
+	}
+
+	return Unexpected<ConnectionError>("{}", last_error);
 }
 
 ExpectedVoid Socket::Client::Send(const Buffer::FIFO& buffer) noexcept {
@@ -93,6 +273,30 @@ ExpectedVoid Socket::Client::Send(const std::vector<std::byte>& buffer) noexcept
 }
 
 ExpectedVoid Socket::Client::Send(std::span<const std::byte> data) noexcept {
+	const std::size_t total = data.size();
+	while (!data.empty()) {
+		// Optimistic: only wait for writability once the kernel buffer is full
+		auto expected_sent = TrySend(data);
+		if (!expected_sent) {
+			return Unexpected(expected_sent.error());
+		}
+
+		data = data.subspan(expected_sent.value());
+		if (!data.empty() && expected_sent.value() == 0) {
+			auto expected_writable = WaitWritable();
+			if (!expected_writable) {
+				return Unexpected(expected_writable.error());
+			}
+		}
+	}
+
+	m_logger << Logger::Level::LowLevel << "All data sent successfully! Total bytes sent: "
+			<< humanreadable_bytes << total << nohumanreadable << std::endl;
+
+	return {};
+}
+
+StormByte::Expected<std::size_t, ConnectionError> Socket::Client::TrySend(std::span<const std::byte> data) noexcept {
 	if (m_status.load(std::memory_order_acquire) != Connection::Status::Connected) {
 		return Unexpected<ConnectionError>("Failed to send: Client is not connected");
 	}
@@ -106,42 +310,8 @@ ExpectedVoid Socket::Client::Send(std::span<const std::byte> data) noexcept {
 		? static_cast<std::size_t>(m_effective_send_buf)
 		: DEFAULT_IO_CHUNK;
 
-	while (!data.empty()) {
-#ifdef UNIX
-		struct pollfd pfd;
-		pfd.fd = m_handle;
-		pfd.events = POLLOUT;
-		int pol = poll(&pfd, 1, 50);
-		if (pol < 0) {
-			return Unexpected<ConnectionError>(
-				"Poll error: {} (error code: {})",
-				Connection::Handler::Instance().LastError(),
-				Connection::Handler::Instance().LastErrorCode());
-		} else if (pol == 0) {
-			continue;
-		} else if (!(pfd.revents & POLLOUT)) {
-			continue;
-		}
-#else
-		fd_set writefds;
-		FD_ZERO(&writefds);
-		FD_SET(m_handle, &writefds);
-		TIMEVAL tv;
-		tv.tv_sec  = 0;
-		tv.tv_usec = 50000;
-		int sel = select(0, nullptr, &writefds, nullptr, &tv);
-		if (sel == SOCKET_ERROR) {
-			return Unexpected<ConnectionError>(
-				"Select error: {} (error code: {})",
-				Connection::Handler::Instance().LastError(),
-				Connection::Handler::Instance().LastErrorCode());
-		} else if (sel == 0) {
-			continue;
-		}
-#endif
-
-		const std::size_t chunk_size = ClampChunk(preferred, data.size());
-		std::span<const std::byte> chunk = data.subspan(0, chunk_size);
+	while (total_bytes_sent < data.size()) {
+		std::span<const std::byte> chunk = data.subspan(total_bytes_sent, ClampChunk(preferred, data.size() - total_bytes_sent));
 
 #ifdef LINUX
 		const int send_flags = MSG_NOSIGNAL;
@@ -157,11 +327,11 @@ ExpectedVoid Socket::Client::Send(std::span<const std::byte> data) noexcept {
 #ifdef WINDOWS
 			const int wsa = Connection::Handler::Instance().LastErrorCode();
 			if (wsa == WSAEWOULDBLOCK) {
-				continue;
+				break;
 			}
 #else
 			if (errno == EAGAIN || errno == EWOULDBLOCK) {
-				continue;
+				break;
 			}
 #endif
 			int sys_errno = errno;
@@ -175,13 +345,53 @@ ExpectedVoid Socket::Client::Send(std::span<const std::byte> data) noexcept {
 		}
 
 		total_bytes_sent += static_cast<std::size_t>(written);
-		data = data.subspan(static_cast<std::size_t>(written));
 	}
 
-	m_logger << Logger::Level::LowLevel << "All data sent successfully! Total bytes sent: "
-			<< humanreadable_bytes << total_bytes_sent << nohumanreadable << std::endl;
+	return total_bytes_sent;
+}
 
-	return {};
+ExpectedVoid Socket::Client::WaitWritable() noexcept {
+	// Bounded slices so a concurrent Disconnect() is noticed
+	constexpr int SLICE_MS = 1000;
+	while (m_status.load(std::memory_order_acquire) == Connection::Status::Connected) {
+#ifdef UNIX
+		struct pollfd pfd;
+		pfd.fd = m_handle;
+		pfd.events = POLLOUT;
+		pfd.revents = 0;
+		const int pol = poll(&pfd, 1, SLICE_MS);
+		if (pol < 0) {
+			if (errno == EINTR)
+				continue;
+			return Unexpected<ConnectionError>(
+				"Poll error: {} (error code: {})",
+				Connection::Handler::Instance().LastError(),
+				Connection::Handler::Instance().LastErrorCode());
+		}
+		if (pol > 0) {
+			if (pfd.revents & (POLLERR | POLLHUP | POLLNVAL))
+				return Unexpected<ConnectionError>("Socket error while waiting to send");
+			return {};
+		}
+#else
+		fd_set writefds;
+		FD_ZERO(&writefds);
+		FD_SET(m_handle, &writefds);
+		TIMEVAL tv;
+		tv.tv_sec  = SLICE_MS / 1000;
+		tv.tv_usec = 0;
+		const int sel = select(0, nullptr, &writefds, nullptr, &tv);
+		if (sel == SOCKET_ERROR) {
+			return Unexpected<ConnectionError>(
+				"Select error: {} (error code: {})",
+				Connection::Handler::Instance().LastError(),
+				Connection::Handler::Instance().LastErrorCode());
+		}
+		if (sel > 0)
+			return {};
+#endif
+	}
+	return Unexpected<ConnectionError>("Failed to send: Client is not connected");
 }
 
 ExpectedVoid Socket::Client::Send(Buffer::Consumer data) noexcept {
@@ -294,7 +504,8 @@ ExpectedBuffer Socket::Client::ReadOnce(const std::size_t& size, int flags) noex
 }
 
 ExpectedVoid Socket::Client::ReceiveLoop(const std::size_t& max_size, Buffer::DataType& out,
-	const unsigned short& timeout_seconds, bool require_exact) noexcept {
+	const unsigned short& timeout_seconds, bool require_exact,
+	const std::function<void(std::span<const std::byte>)>* on_chunk) noexcept {
 	if (!m_handle) {
 		return Unexpected<ConnectionError>("Receive failed: Invalid socket handle");
 	}
@@ -312,19 +523,13 @@ ExpectedVoid Socket::Client::ReceiveLoop(const std::size_t& max_size, Buffer::Da
 	}
 
 	std::size_t total_bytes_read = 0;
-	const auto start_time = std::chrono::steady_clock::now();
+	// Armed on the shared wheel the first time a read would block, so reads served
+	// from the socket buffer never take the wheel's lock
+	std::optional<Executor::Deadline> deadline;
 
 	const std::size_t buf_cap = ClampChunk(preferred, max_size > 0 ? max_size : MAX_SINGLE_IO);
 	std::vector<char> internal_buffer(buf_cap);
 
-	auto timed_out = [&]() -> bool {
-		if (timeout_seconds == 0) {
-			return false;
-		}
-		const auto now = std::chrono::steady_clock::now();
-		return std::chrono::duration_cast<std::chrono::seconds>(now - start_time).count() >= timeout_seconds;
-	};
-
 	while (true) {
 		if (max_size > 0 && total_bytes_read >= max_size) {
 			break;
@@ -348,6 +553,9 @@ ExpectedVoid Socket::Client::ReceiveLoop(const std::size_t& max_size, Buffer::Da
 			const auto* p = reinterpret_cast<const std::byte*>(internal_buffer.data());
 			out.insert(out.end(), p, p + static_cast<std::size_t>(valread));
 			total_bytes_read += static_cast<std::size_t>(valread);
+			if (on_chunk) {
+				(*on_chunk)(std::span<const std::byte>(p, static_cast<std::size_t>(valread)));
+			}
 			continue;
 		}
 
@@ -367,7 +575,10 @@ ExpectedVoid Socket::Client::ReceiveLoop(const std::size_t& max_size, Buffer::Da
 		if (Connection::Handler::Instance().LastErrorCode() == EAGAIN ||
 			Connection::Handler::Instance().LastErrorCode() == EWOULDBLOCK) {
 #endif
-			if (timed_out()) {
+			if (!deadline) {
+				deadline.emplace(std::chrono::seconds(timeout_seconds));
+			}
+			else if (deadline->Expired()) {
 				return Unexpected<ConnectionError>("Receive timed out");
 			}
 
@@ -379,7 +590,7 @@ ExpectedVoid Socket::Client::ReceiveLoop(const std::size_t& max_size, Buffer::Da
 				break;
 			}
 			if (wait_res.value() == Connection::Read::Result::Timeout) {
-				if (timed_out()) {
+				if (deadline->Expired()) {
 					return Unexpected<ConnectionError>("Receive timed out");
 				}
 				if (!require_exact && max_size == 0 && total_bytes_read > 0) {
@@ -423,6 +634,14 @@ ExpectedVoid Socket::Client::ReceiveInto(const std::size_t& max_size, Buffer::Da
 	return ReceiveLoop(max_size, out, timeout_seconds, true);
 }
 
+ExpectedVoid Socket::Client::ReceiveInto(const std::size_t& max_size, Buffer::DataType& out,
+	const std::function<void(std::span<const std::byte>)>& on_chunk, const unsigned short& timeout_seconds) noexcept {
+	m_logger << Logger::Level::LowLevel << "Starting ReceiveInto with max_size: "
+			<< humanreadable_bytes << max_size << nohumanreadable << std::endl;
+
+	return ReceiveLoop(max_size, out, timeout_seconds, true, &on_chunk);
+}
+
 ExpectedVoid Socket::Client::Write(std::span<const std::byte> data, const std::size_t& size) noexcept {
 	m_logger << Logger::Level::LowLevel << "Starting to write data..." << std::endl;
 
@@ -455,14 +674,17 @@ ExpectedVoid Socket::Client::Write(std::span<const std::byte> data, const std::s
 
 		if (written <= 0) {
 #ifdef WINDOWS
-			if (Connection::Handler::Instance().LastErrorCode() == WSAEWOULDBLOCK) {
-				continue;
-			}
+			const bool would_block = Connection::Handler::Instance().LastErrorCode() == WSAEWOULDBLOCK;
 #else
-			if (errno == EAGAIN || errno == EWOULDBLOCK) {
+			const bool would_block = errno == EAGAIN || errno == EWOULDBLOCK;
+#endif
+			if (would_block) {
+				auto expected_writable = WaitWritable();
+				if (!expected_writable) {
+					return Unexpected(expected_writable.error());
+				}
 				continue;
 			}
-#endif
 			int sys_errno = errno;
 			m_logger << Logger::Level::Error << "Write failed: " << Connection::Handler::Instance().LastError()
 					<< " (code: " << Connection::Handler::Instance().LastErrorCode() << ")"
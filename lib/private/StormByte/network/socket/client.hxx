@@ -20,11 +20,14 @@
 #pragma once
 
 #include <StormByte/buffer/consumer.hxx>
+#include <StormByte/network/connection/dial.hxx>
 #include <StormByte/network/socket/reader.hxx>
 #include <StormByte/network/socket/socket.hxx>
 #include <StormByte/network/socket/writer.hxx>
 #include <StormByte/network/typedefs.hxx>
 
+#include <chrono>
+#include <functional>
 #include <span>
 
 /**
@@ -70,12 +73,14 @@ namespace StormByte::Network::Socket {
 			Client& operator=(Client&& other) noexcept = default;
 
 			/**
-			 * Connects to host:port.
+			 * Connects to host:port, racing every resolved address as
+			 * @p options describes.
 			 * @param hostname Host name.
 			 * @param port Port.
+			 * @param options Deadline and attempt stagger.
 			 * @return Empty Expected on success.
 			 */
-			ExpectedVoid Connect(const std::string& hostname, const unsigned short& port) noexcept;
+			ExpectedVoid Connect(const std::string& hostname, const unsigned short& port, const Connection::DialOptions& options = {}) noexcept;
 
 			/**
 			 * @return Reader adapter for this client.
@@ -108,6 +113,17 @@ namespace StormByte::Network::Socket {
 			 */
 			ExpectedVoid ReceiveInto(const std::size_t& size, Buffer::DataType& out, const unsigned short& timeout_seconds = 0) noexcept;
 
+			/**
+			 * Receives exactly into @p out (append), reporting every chunk as it
+			 * arrives so callers can process data while the rest is in flight.
+			 * @param size Required byte count.
+			 * @param out Destination.
+			 * @param on_chunk Called with each received chunk (already appended to @p out).
+			 * @param timeout_seconds Timeout between chunks (0 = forever).
+			 * @return Empty Expected on success.
+			 */
+			ExpectedVoid ReceiveInto(const std::size_t& size, Buffer::DataType& out, const std::function<void(std::span<const std::byte>)>& on_chunk, const unsigned short& timeout_seconds = 0) noexcept;
+
 			/**
 			 * Peeks without consuming (MSG_PEEK).
 			 * @param size Bytes to peek.
@@ -130,12 +146,20 @@ namespace StormByte::Network::Socket {
 			ExpectedVoid Send(const std::vector<std::byte>& buffer) noexcept;
 
 			/**
-			 * Sends a byte span.
+			 * Sends a byte span, waiting for writability whenever the kernel
+			 * send buffer is full.
 			 * @param data Data.
 			 * @return Empty Expected on success.
 			 */
 			ExpectedVoid Send(std::span<const std::byte> data) noexcept;
 
+			/**
+			 * Sends as much of @p data as the kernel accepts without blocking.
+			 * @param data Data.
+			 * @return Bytes sent (0 if the send buffer is full) or error.
+			 */
+			Expected<std::size_t, ConnectionError> TrySend(std::span<const std::byte> data) noexcept;
+
 			/**
 			 * Sends from a Consumer until EoF.
 			 * @param data Consumer.
@@ -162,6 +186,16 @@ namespace StormByte::Network::Socket {
 			}
 
 		private:
+			/**
+			 * Non-blocking connect attempts over @p addresses; the first to
+			 * complete becomes this socket's handle.
+			 * @param addresses Candidates, in attempt order.
+			 * @param start When the connect began (the timeout also covers resolving).
+			 * @param options Deadline and attempt stagger.
+			 * @return Empty Expected on success.
+			 */
+			ExpectedVoid Dial(std::vector<Connection::Info>&& addresses, const std::chrono::steady_clock::time_point& start, const Connection::DialOptions& options) noexcept;
+
 			/**
 			 * Single recv with flags.
 			 * @param size Max bytes.
@@ -181,11 +215,19 @@ namespace StormByte::Network::Socket {
 			 * Shared receive loop for Receive / ReceiveInto.
 			 * @param max_size Cap (0 = until peer close if !require_exact).
 			 * @param out Append target.
-			 * @param timeout_seconds Inter-chunk timeout.
+			 * @param timeout_seconds Timeout once a read would block (0 = forever).
 			 * @param require_exact Peer close early is error when true.
+			 * @param on_chunk Optional per-chunk callback (nullptr = none).
 			 * @return Empty Expected on success.
 			 */
-			ExpectedVoid ReceiveLoop(const std::size_t& max_size, Buffer::DataType& out, const unsigned short& timeout_seconds, bool require_exact) noexcept;
+			ExpectedVoid ReceiveLoop(const std::size_t& max_size, Buffer::DataType& out, const unsigned short& timeout_seconds, bool require_exact, const std::function<void(std::span<const std::byte>)>* on_chunk = nullptr) noexcept;
+
+			/**
+			 * Blocks until the socket accepts more data (in bounded slices, so
+			 * a disconnect ends the wait).
+			 * @return Empty Expected once writable, error on disconnect / socket error.
+			 */
+			ExpectedVoid WaitWritable() noexcept;
 
 			/**
 			 * Low-level write of @p size bytes from @p data.
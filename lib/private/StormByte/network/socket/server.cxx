@@ -11,14 +11,13 @@
 #endif
 
 #include <StormByte/network/connection/handler.hxx>
-#include <algorithm>
 #include <memory>
 
 using namespace StormByte::Network;
 
 Socket::Server::Server(const Connection::Protocol& protocol, std::shared_ptr<Logger::Log> logger) noexcept:
 Socket(protocol, logger) {
-	m_logger << Logger::Level::LowLevel << "Created server socket with UUID: " << m_UUID << std::endl;
+	m_logger << Logger::Level::LowLevel << "Created server socket" << std::endl;
 }
 
 ExpectedVoid Socket::Server::Listen(const std::string& hostname, const unsigned short& port) noexcept {
@@ -63,7 +62,7 @@ ExpectedVoid Socket::Server::Listen(const std::string& hostname, const unsigned
 
 	m_conn_info = std::make_unique<Connection::Info>(std::move(expected_connection_info.value()));
 
-	auto bind_result = ::bind(m_handle, m_conn_info->SockAddr().get(), sizeof(*m_conn_info->SockAddr()));
+	auto bind_result = ::bind(m_handle, m_conn_info->SockAddr().get(), m_conn_info->SockAddrSize());
 	if (bind_result == -1) {
 		m_status.store(Connection::Status::Disconnected, std::memory_order_release);
 #ifdef WINDOWS
@@ -136,27 +135,5 @@ ExpectedClient Socket::Server::Accept() noexcept {
 	client_socket.m_handle = client_handle;
 	client_socket.InitializeAfterConnect();
 
-	m_active_clients.push_back(std::make_shared<Client>(std::move(client_socket)));
-	return m_active_clients.back();
-}
-
-void Socket::Server::Disconnect() noexcept {
-	for (auto& client : m_active_clients) {
-		if (!client) continue;
-		client->Disconnect();
-	}
-	m_active_clients.clear();
-
-	Socket::Disconnect();
-}
-
-void Socket::Server::DisconnectClient(const std::string& client_uuid) noexcept {
-	auto it = std::find_if(m_active_clients.begin(), m_active_clients.end(),
-		[&client_uuid](const std::shared_ptr<Client>& client) {
-			return client && client->UUID() == client_uuid;
-		});
-	if (it != m_active_clients.end()) {
-		(*it)->Disconnect();
-		m_active_clients.erase(it);
-	}
+	return std::make_shared<Client>(std::move(client_socket));
 }
\ No newline at end of file
@@ -21,7 +21,6 @@
 
 #include <StormByte/network/socket/client.hxx>
 #include <StormByte/network/typedefs.hxx>
-#include <vector>
 
 /**
  * @namespace Socket
@@ -31,6 +30,9 @@ namespace StormByte::Network::Socket {
 	/**
 	 * @class Server
 	 * @brief Listening socket: bind, listen, accept.
+	 *
+	 * Accepted clients are owned by the caller (Network::Server keeps them in
+	 * its connection registry); the listener does not track them.
 	 */
 	class STORMBYTE_NETWORK_PRIVATE Server final: public Socket {
 		public:
@@ -79,18 +81,5 @@ namespace StormByte::Network::Socket {
 			 */
 			ExpectedClient Accept() noexcept;
 
-			/**
-			 * Disconnects all accepted clients then the listener.
-			 */
-			void Disconnect() noexcept override;
-
-			/**
-			 * Disconnects one accepted client by UUID.
-			 * @param client_uuid Client UUID.
-			 */
-			void DisconnectClient(const std::string& client_uuid) noexcept;
-
-		private:
-			std::vector<std::shared_ptr<Client>> m_active_clients;	///< Accepted clients
 	};
 }
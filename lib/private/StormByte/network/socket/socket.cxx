@@ -37,7 +37,7 @@ using namespace StormByte::Network::Socket;
 Socket::Socket(const Connection::Protocol& protocol, std::shared_ptr<Logger::Log> logger) noexcept:
 m_protocol(protocol), m_status(Connection::Status::Disconnected),
 m_handle(-1), m_conn_info(nullptr), m_mtu(DEFAULT_MTU), m_logger(logger),
-m_UUID(StormByte::GenerateUUIDv4()) {
+m_UUID() {
 	(void)StormByte::Network::Connection::Handler::Instance();
 }
 
@@ -80,6 +80,13 @@ Socket::~Socket() noexcept {
 	Disconnect();
 }
 
+const std::string& Socket::UUID() const noexcept {
+	std::scoped_lock lock(m_UUID_mutex);
+	if (m_UUID.empty())
+		m_UUID = StormByte::GenerateUUIDv4();
+	return m_UUID;
+}
+
 void Socket::Disconnect() noexcept {
 	// Only one thread performs the real close.
 	auto prev = m_status.exchange(Connection::Status::Disconnecting,
@@ -89,6 +96,7 @@ void Socket::Disconnect() noexcept {
 		return;
 	}
 
+	const Connection::HandlerType handle = m_handle;
 	if (m_handle > 0) {
 #ifdef UNIX
 		shutdown(m_handle, SHUT_RDWR);
@@ -104,7 +112,18 @@ void Socket::Disconnect() noexcept {
 	}
 
 	m_status.store(Connection::Status::Disconnected, std::memory_order_release);
-	m_logger << Logger::Level::LowLevel << "Disconnected socket " << m_UUID << std::endl;
+	m_logger << Logger::Level::LowLevel << "Disconnected socket " << handle << std::endl;
+}
+
+void Socket::Interrupt() noexcept {
+	if (!Connection::IsConnected(m_status.load(std::memory_order_acquire)))
+		return;
+#ifdef UNIX
+	shutdown(m_handle, SHUT_RDWR);
+#else
+	shutdown(m_handle, SD_BOTH);
+#endif
+	m_logger << Logger::Level::LowLevel << "Interrupted socket " << m_handle << std::endl;
 }
 
 StormByte::Network::ExpectedReadResult Socket::WaitForData(const long long& usecs) noexcept {
@@ -136,7 +155,7 @@ StormByte::Network::ExpectedReadResult Socket::WaitForData(const long long& usec
 			return;
 		logged_waiting = true;
 		m_logger << Logger::Level::LowLevel
-				<< "Still waiting for data on socket " << m_UUID
+				<< "Still waiting for data on socket " << m_handle
 				<< " (elapsed " << elapsed_ms() << " ms)" << std::endl;
 		next_progress_log = now + PROGRESS_INTERVAL;
 	};
@@ -146,7 +165,7 @@ StormByte::Network::ExpectedReadResult Socket::WaitForData(const long long& usec
 		if (!logged_waiting && ms < 1000)
 			return;
 		m_logger << Logger::Level::LowLevel
-				<< "Wait for data on socket " << m_UUID << ": " << reason
+				<< "Wait for data on socket " << m_handle << ": " << reason
 				<< " after " << ms << " ms" << std::endl;
 	};
 
@@ -29,6 +29,7 @@
 #include <StormByte/network/typedefs.hxx>
 
 #include <atomic>
+#include <mutex>
 
 /**
  * @namespace Socket
@@ -79,6 +80,13 @@ namespace StormByte::Network::Socket {
 			 */
 			virtual void Disconnect() noexcept;
 
+			/**
+			 * Shuts the connection down without closing the handle, so a thread
+			 * blocked reading it wakes up and sees it closed; @ref Disconnect()
+			 * still has to be called. Non-blocking.
+			 */
+			void Interrupt() noexcept;
+
 			/**
 			 * @return Current connection status.
 			 */
@@ -101,11 +109,11 @@ namespace StormByte::Network::Socket {
 			}
 
 			/**
+			 * Human-readable label, generated on first call (connections are
+			 * identified by Connection::ID; this is for logs and users only).
 			 * @return Socket UUID.
 			 */
-			inline const std::string& UUID() const noexcept {
-				return m_UUID;
-			}
+			const std::string& UUID() const noexcept;
 
 			/**
 			 * Waits for readable data (or peer close / timeout).
@@ -149,7 +157,8 @@ namespace StormByte::Network::Socket {
 
 		private:
 			constexpr static const unsigned short DEFAULT_MTU = 1500;
-			std::string m_UUID;	///< Instance UUID
+			mutable std::string m_UUID;				///< Instance UUID (lazy)
+			mutable std::mutex m_UUID_mutex;		///< Protects m_UUID generation
 
 			/**
 			 * @return Path MTU or DEFAULT_MTU.
@@ -0,0 +1,63 @@
+#include <StormByte/network/transport/batch.hxx>
+#include <StormByte/serializable.hxx>
+
+#include <limits>
+
+using StormByte::Buffer::DataType;
+using namespace StormByte::Network::Transport;
+
+bool Batch::Add(const Packet& packet) noexcept {
+	Frame frame(packet);
+	if (frame.m_payload.size() > std::numeric_limits<std::uint32_t>::max())
+		return false;
+
+	if (m_count == 0)
+		m_started = std::chrono::steady_clock::now();
+
+	const DataType opcode = Serializable<Packet::OpcodeType>(frame.m_opcode).Serialize();
+	const DataType size = Serializable<std::uint32_t>(static_cast<std::uint32_t>(frame.m_payload.size())).Serialize();
+	m_payload.reserve(m_payload.size() + ENTRY_HEADER_SIZE + frame.m_payload.size());
+	m_payload.insert(m_payload.end(), opcode.begin(), opcode.end());
+	m_payload.insert(m_payload.end(), size.begin(), size.end());
+	m_payload.insert(m_payload.end(), frame.m_payload.begin(), frame.m_payload.end());
+	++m_count;
+	return true;
+}
+
+std::chrono::steady_clock::duration Batch::Age() const noexcept {
+	return m_count == 0 ? std::chrono::steady_clock::duration::zero() : std::chrono::steady_clock::now() - m_started;
+}
+
+Frame Batch::Release() noexcept {
+	Frame frame(static_cast<Packet::OpcodeType>(Control::Batch), std::move(m_payload));
+	m_payload = DataType();
+	m_count = 0;
+	return frame;
+}
+
+StormByte::Expected<std::vector<Frame>, StormByte::Network::FrameError> Batch::Split(const Frame& frame) noexcept {
+	const DataType& payload = frame.m_payload;
+	std::vector<Frame> frames;
+
+	std::size_t offset = 0;
+	while (offset < payload.size()) {
+		if (payload.size() - offset < ENTRY_HEADER_SIZE)
+			return Unexpected<FrameError>("Truncated batch entry header at offset {}", offset);
+
+		auto expected_opcode = Serializable<Packet::OpcodeType>::Deserialize(DataType(payload.begin() + offset, payload.begin() + offset + sizeof(Packet::OpcodeType)));
+		offset += sizeof(Packet::OpcodeType);
+		auto expected_size = Serializable<std::uint32_t>::Deserialize(DataType(payload.begin() + offset, payload.begin() + offset + sizeof(std::uint32_t)));
+		offset += sizeof(std::uint32_t);
+		if (!expected_opcode || !expected_size)
+			return Unexpected<FrameError>("Malformed batch entry header");
+
+		const std::size_t size = expected_size.value();
+		if (size > payload.size() - offset)
+			return Unexpected<FrameError>("Batch entry {} exceeds frame payload", frames.size());
+
+		frames.push_back(Frame(expected_opcode.value(), DataType(payload.begin() + offset, payload.begin() + offset + size)));
+		offset += size;
+	}
+
+	return frames;
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <StormByte/network/exception.hxx>
+#include <StormByte/network/transport/frame.hxx>
+
+#include <chrono>
+#include <vector>
+
+/**
+ * @namespace Transport
+ * @brief Application-layer messages (Packet, Frame) and on-wire layout.
+ */
+namespace StormByte::Network::Transport {
+	/**
+	 * @class Batch
+	 * @brief Packs several packets into one @ref Control::Batch frame.
+	 *
+	 * Payload layout, repeated per packet:
+	 * - Opcode: sizeof(Packet::OpcodeType)
+	 * - Payload size: sizeof(std::uint32_t)
+	 * - Payload: variable (may be empty)
+	 *
+	 * The whole frame runs through the pipelines and codec once.
+	 */
+	class STORMBYTE_NETWORK_PRIVATE Batch final {
+		public:
+			/**
+			 * Per-packet header size.
+			 */
+			static constexpr std::size_t ENTRY_HEADER_SIZE = sizeof(Packet::OpcodeType) + sizeof(std::uint32_t);
+
+			/**
+			 * Empty batch.
+			 */
+			Batch() noexcept = default;
+
+			/**
+			 * Copy constructor.
+			 */
+			Batch(const Batch& other) = default;
+
+			/**
+			 * Move constructor.
+			 */
+			Batch(Batch&& other) noexcept = default;
+
+			/**
+			 * Destructor.
+			 */
+			~Batch() noexcept = default;
+
+			/**
+			 * Copy assignment.
+			 */
+			Batch& operator=(const Batch& other) = default;
+
+			/**
+			 * Move assignment.
+			 */
+			Batch& operator=(Batch&& other) noexcept = default;
+
+			/**
+			 * Appends @p packet to the batch.
+			 * @param packet Packet to pack.
+			 * @return false if the packet payload does not fit the entry size field.
+			 */
+			bool Add(const Packet& packet) noexcept;
+
+			/**
+			 * @return Number of packed packets.
+			 */
+			inline std::size_t Count() const noexcept {
+				return m_count;
+			}
+
+			/**
+			 * @return Packed bytes (entry headers included).
+			 */
+			inline std::size_t Size() const noexcept {
+				return m_payload.size();
+			}
+
+			/**
+			 * @return true if no packet was added.
+			 */
+			inline bool Empty() const noexcept {
+				return m_count == 0;
+			}
+
+			/**
+			 * @return Time elapsed since the first packet was added.
+			 */
+			std::chrono::steady_clock::duration Age() const noexcept;
+
+			/**
+			 * Builds the batch frame and leaves the batch empty.
+			 * @return Batch frame.
+			 */
+			Frame Release() noexcept;
+
+			/**
+			 * Unpacks a batch frame into one frame per packet, in order.
+			 * @param frame Received @ref Control::Batch frame.
+			 * @return Frames or FrameError on a malformed batch.
+			 */
+			static Expected<std::vector<Frame>, FrameError> Split(const Frame& frame) noexcept;
+
+		private:
+			Buffer::DataType m_payload;								///< Packed entries
+			std::size_t m_count = 0;								///< Packed packets
+			std::chrono::steady_clock::time_point m_started;		///< First packet added at
+	};
+}
@@ -0,0 +1,290 @@
+#include <StormByte/network/transport/codec.hxx>
+#include <StormByte/serializable.hxx>
+
+#ifdef STORMBYTE_NETWORK_LZ4
+#include <lz4.h>
+#endif
+#ifdef STORMBYTE_NETWORK_ZSTD
+#include <zstd.h>
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <optional>
+
+using StormByte::Buffer::DataType;
+using StormByte::Network::FrameError;
+using StormByte::Network::Transport::Compression::Algorithm;
+using namespace StormByte::Network::Transport;
+
+namespace {
+#ifdef STORMBYTE_NETWORK_ZSTD
+	/**
+	 * Per-thread zstd contexts (creating them per block is expensive).
+	 */
+	struct ZstdContexts {
+		ZSTD_CCtx* cctx = ZSTD_createCCtx();
+		ZSTD_DCtx* dctx = ZSTD_createDCtx();
+		~ZstdContexts() {
+			ZSTD_freeCCtx(cctx);
+			ZSTD_freeDCtx(dctx);
+		}
+	};
+
+	ZstdContexts& ThreadZstd() noexcept {
+		thread_local ZstdContexts contexts;
+		return contexts;
+	}
+#endif
+
+	/**
+	 * Writes @p value serialized at @p offset of @p out.
+	 */
+	template <typename T>
+	void WriteAt(DataType& out, std::size_t offset, const T& value) noexcept {
+		const DataType bytes = StormByte::Serializable<T>(value).Serialize();
+		std::copy(bytes.begin(), bytes.end(), out.begin() + offset);
+	}
+
+	/**
+	 * Reads a serialized T at @p offset of @p in (bounds checked by caller).
+	 */
+	template <typename T>
+	std::optional<T> ReadAt(std::span<const std::byte> in, std::size_t offset) noexcept {
+		auto expected = StormByte::Serializable<T>::Deserialize(DataType(in.begin() + offset, in.begin() + offset + sizeof(T)));
+		if (!expected)
+			return std::nullopt;
+		return expected.value();
+	}
+
+	/**
+	 * Builds a stored (uncompressed) block.
+	 */
+	DataType Store(std::span<const std::byte> data) noexcept {
+		DataType block(Codec::HEADER_SIZE + data.size());
+		WriteAt<std::uint8_t>(block, 0, static_cast<std::uint8_t>(Algorithm::None));
+		WriteAt<std::uint32_t>(block, sizeof(std::uint8_t), 0);
+		WriteAt<std::size_t>(block, sizeof(std::uint8_t) + sizeof(std::uint32_t), data.size());
+		std::copy(data.begin(), data.end(), block.begin() + Codec::HEADER_SIZE);
+		return block;
+	}
+}
+
+struct Codec::Dictionary {
+	DataType bytes;							///< Raw dictionary
+	std::uint32_t id;						///< Identifier carried by blocks
+#ifdef STORMBYTE_NETWORK_LZ4
+	LZ4_stream_t* lz4 = nullptr;			///< Stream with the dictionary loaded (copied per block)
+#endif
+#ifdef STORMBYTE_NETWORK_ZSTD
+	ZSTD_CDict* cdict = nullptr;			///< Digested compression dictionary
+	ZSTD_DDict* ddict = nullptr;			///< Digested decompression dictionary
+#endif
+
+	~Dictionary() {
+#ifdef STORMBYTE_NETWORK_LZ4
+		if (lz4)
+			LZ4_freeStream(lz4);
+#endif
+#ifdef STORMBYTE_NETWORK_ZSTD
+		ZSTD_freeCDict(cdict);
+		ZSTD_freeDDict(ddict);
+#endif
+	}
+};
+
+Codec::Codec(const Compression::Options& options) noexcept:
+	m_algorithm(Compression::IsAvailable(options.algorithm) ? options.algorithm : Algorithm::None),
+	m_level(options.level),
+	m_min_size(options.min_size) {
+	for (const auto& [opcode, bytes] : options.dictionaries) {
+		if (bytes.empty())
+			continue;
+
+		auto dictionary = std::make_shared<Dictionary>();
+		dictionary->bytes = bytes;
+		dictionary->id = Compression::DictionaryID(bytes);
+#ifdef STORMBYTE_NETWORK_LZ4
+		if (m_algorithm == Algorithm::LZ4 && (dictionary->lz4 = LZ4_createStream()) != nullptr)
+			LZ4_loadDict(dictionary->lz4, reinterpret_cast<const char*>(dictionary->bytes.data()), static_cast<int>(dictionary->bytes.size()));
+#endif
+#ifdef STORMBYTE_NETWORK_ZSTD
+		if (m_algorithm == Algorithm::Zstd)
+			dictionary->cdict = ZSTD_createCDict(dictionary->bytes.data(), dictionary->bytes.size(), m_level != 0 ? m_level : ZSTD_CLEVEL_DEFAULT);
+		dictionary->ddict = ZSTD_createDDict(dictionary->bytes.data(), dictionary->bytes.size());
+#endif
+		m_dictionaries.emplace(opcode, std::move(dictionary));
+	}
+}
+
+Codec::~Codec() noexcept = default;
+
+std::unordered_map<StormByte::Network::Transport::Packet::OpcodeType, std::uint32_t> Codec::DictionaryIDs() const noexcept {
+	std::unordered_map<Packet::OpcodeType, std::uint32_t> ids;
+	for (const auto& [opcode, dictionary] : m_dictionaries)
+		ids.emplace(opcode, dictionary->id);
+	return ids;
+}
+
+std::shared_ptr<const Codec> Codec::Restrict(const std::uint8_t& algorithms, const std::unordered_map<Packet::OpcodeType, std::uint32_t>& dictionaries) const noexcept {
+	std::shared_ptr<Codec> codec(new Codec());
+	const bool decodable = (algorithms & (1u << static_cast<std::uint8_t>(m_algorithm))) != 0;
+	codec->m_algorithm = decodable ? m_algorithm : Algorithm::None;
+	codec->m_level = m_level;
+	codec->m_min_size = m_min_size;
+	for (const auto& [opcode, dictionary] : m_dictionaries) {
+		auto it = dictionaries.find(opcode);
+		if (it != dictionaries.end() && it->second == dictionary->id)
+			codec->m_dictionaries.emplace(opcode, dictionary);
+	}
+	return codec;
+}
+
+bool Codec::EncodesLike(const Codec& other, const Packet::OpcodeType& opcode) const noexcept {
+	// Restricted codecs share prepared dictionaries, so pointers identify them
+	return m_algorithm == other.m_algorithm && m_level == other.m_level && m_min_size == other.m_min_size
+		&& Find(opcode) == other.Find(opcode);
+}
+
+DataType Codec::Compress(const Packet::OpcodeType& opcode, std::span<const std::byte> data) const noexcept {
+	if (m_algorithm == Algorithm::None || data.empty())
+		return Store(data);
+
+	const Dictionary* dictionary = Find(opcode);
+	DataType block;
+	std::size_t written = 0;
+
+	switch (m_algorithm) {
+#ifdef STORMBYTE_NETWORK_LZ4
+		case Algorithm::LZ4: {
+			if (data.size() > LZ4_MAX_INPUT_SIZE)
+				return Store(data);
+
+			const int acceleration = m_level > 0 ? m_level : 1;
+			const int bound = LZ4_compressBound(static_cast<int>(data.size()));
+			block.resize(HEADER_SIZE + bound);
+			const char* src = reinterpret_cast<const char*>(data.data());
+			char* dst = reinterpret_cast<char*>(block.data() + HEADER_SIZE);
+
+			int result;
+			if (dictionary && dictionary->lz4) {
+				// Copying the loaded stream avoids re-hashing the dictionary for every block
+				thread_local LZ4_stream_t stream;
+				std::memcpy(&stream, dictionary->lz4, sizeof(LZ4_stream_t));
+				result = LZ4_compress_fast_continue(&stream, src, dst, static_cast<int>(data.size()), bound, acceleration);
+			}
+			else {
+				dictionary = nullptr;
+				result = LZ4_compress_fast(src, dst, static_cast<int>(data.size()), bound, acceleration);
+			}
+			if (result <= 0)
+				return Store(data);
+			written = static_cast<std::size_t>(result);
+			break;
+		}
+#endif
+#ifdef STORMBYTE_NETWORK_ZSTD
+		case Algorithm::Zstd: {
+			const std::size_t bound = ZSTD_compressBound(data.size());
+			block.resize(HEADER_SIZE + bound);
+			ZstdContexts& contexts = ThreadZstd();
+
+			std::size_t result;
+			if (dictionary && dictionary->cdict) {
+				result = ZSTD_compress_usingCDict(contexts.cctx, block.data() + HEADER_SIZE, bound, data.data(), data.size(), dictionary->cdict);
+			}
+			else {
+				dictionary = nullptr;
+				result = ZSTD_compressCCtx(contexts.cctx, block.data() + HEADER_SIZE, bound, data.data(), data.size(), m_level != 0 ? m_level : ZSTD_CLEVEL_DEFAULT);
+			}
+			if (ZSTD_isError(result))
+				return Store(data);
+			written = result;
+			break;
+		}
+#endif
+		default:
+			return Store(data);
+	}
+
+	if (written >= data.size())
+		return Store(data);
+
+	block.resize(HEADER_SIZE + written);
+	WriteAt<std::uint8_t>(block, 0, static_cast<std::uint8_t>(m_algorithm));
+	WriteAt<std::uint32_t>(block, sizeof(std::uint8_t), dictionary ? dictionary->id : 0);
+	WriteAt<std::size_t>(block, sizeof(std::uint8_t) + sizeof(std::uint32_t), data.size());
+	return block;
+}
+
+StormByte::Expected<DataType, FrameError> Codec::Decompress(const Packet::OpcodeType& opcode, std::span<const std::byte> block, const std::size_t& max_size) const noexcept {
+	if (block.size() < HEADER_SIZE)
+		return Unexpected<FrameError>("Truncated compressed block ({} bytes)", block.size());
+
+	const auto algorithm = ReadAt<std::uint8_t>(block, 0);
+	const auto dictionary_id = ReadAt<std::uint32_t>(block, sizeof(std::uint8_t));
+	const auto original_size = ReadAt<std::size_t>(block, sizeof(std::uint8_t) + sizeof(std::uint32_t));
+	if (!algorithm || !dictionary_id || !original_size)
+		return Unexpected<FrameError>("Malformed compressed block header");
+	// The header is untrusted: reject before allocating the output
+	if (*original_size > std::min(max_size, MAX_BLOCK_SIZE))
+		return Unexpected<FrameError>("Compressed block too large ({} bytes)", *original_size);
+
+	const std::span<const std::byte> data = block.subspan(HEADER_SIZE);
+	const Dictionary* dictionary = nullptr;
+	if (*dictionary_id != 0) {
+		dictionary = Find(opcode);
+		if (!dictionary || dictionary->id != *dictionary_id)
+			return Unexpected<FrameError>("Dictionary mismatch for opcode {}", opcode);
+	}
+
+	DataType result(*original_size);
+	switch (static_cast<Compression::Algorithm>(*algorithm)) {
+		case Algorithm::None:
+			if (data.size() != *original_size)
+				return Unexpected<FrameError>("Stored block size mismatch");
+			std::copy(data.begin(), data.end(), result.begin());
+			return result;
+
+#ifdef STORMBYTE_NETWORK_LZ4
+		case Algorithm::LZ4: {
+			if (*original_size > static_cast<std::size_t>(std::numeric_limits<int>::max()) || data.size() > static_cast<std::size_t>(std::numeric_limits<int>::max()))
+				return Unexpected<FrameError>("LZ4 block too large");
+
+			const char* src = reinterpret_cast<const char*>(data.data());
+			char* dst = reinterpret_cast<char*>(result.data());
+			const int decoded = dictionary
+				? LZ4_decompress_safe_usingDict(src, dst, static_cast<int>(data.size()), static_cast<int>(result.size()),
+					reinterpret_cast<const char*>(dictionary->bytes.data()), static_cast<int>(dictionary->bytes.size()))
+				: LZ4_decompress_safe(src, dst, static_cast<int>(data.size()), static_cast<int>(result.size()));
+			if (decoded < 0 || static_cast<std::size_t>(decoded) != *original_size)
+				return Unexpected<FrameError>("LZ4 decompression failed");
+			return result;
+		}
+#endif
+#ifdef STORMBYTE_NETWORK_ZSTD
+		case Algorithm::Zstd: {
+			if (dictionary && !dictionary->ddict)
+				return Unexpected<FrameError>("Zstd dictionary for opcode {} is unavailable", opcode);
+
+			ZstdContexts& contexts = ThreadZstd();
+			const std::size_t decoded = dictionary
+				? ZSTD_decompress_usingDDict(contexts.dctx, result.data(), result.size(), data.data(), data.size(), dictionary->ddict)
+				: ZSTD_decompressDCtx(contexts.dctx, result.data(), result.size(), data.data(), data.size());
+			if (ZSTD_isError(decoded))
+				return Unexpected<FrameError>("Zstd decompression failed: {}", ZSTD_getErrorName(decoded));
+			if (decoded != *original_size)
+				return Unexpected<FrameError>("Zstd decompression size mismatch");
+			return result;
+		}
+#endif
+		default:
+			return Unexpected<FrameError>("Unsupported compression algorithm {}", *algorithm);
+	}
+}
+
+const Codec::Dictionary* Codec::Find(const Packet::OpcodeType& opcode) const noexcept {
+	auto it = m_dictionaries.find(opcode);
+	return it != m_dictionaries.end() ? it->second.get() : nullptr;
+}
@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <StormByte/expected.hxx>
+#include <StormByte/network/exception.hxx>
+#include <StormByte/network/transport/compression.hxx>
+
+#include <memory>
+#include <span>
+
+/**
+ * @namespace Transport
+ * @brief Application-layer messages (Packet, Frame) and on-wire layout.
+ */
+namespace StormByte::Network::Transport {
+	/**
+	 * @class Codec
+	 * @brief Block compressor shared by every connection of an endpoint.
+	 *
+	 * Block layout:
+	 * - Algorithm: 1 byte (@ref Compression::Algorithm, None = stored)
+	 * - Dictionary ID: 4 bytes (0 = no dictionary)
+	 * - Original size: sizeof(std::size_t)
+	 * - Data: compressed (or stored) bytes
+	 *
+	 * Dictionaries are prepared once (zstd CDict/DDict, loaded LZ4 stream) and
+	 * are immutable afterwards; codec contexts are per thread, so one Codec can
+	 * be used concurrently. Decompression accepts any algorithm built into the
+	 * library, regardless of the outbound one.
+	 */
+	class STORMBYTE_NETWORK_PRIVATE Codec final {
+		public:
+			/**
+			 * Block header size.
+			 */
+			static constexpr std::size_t HEADER_SIZE = sizeof(std::uint8_t) + sizeof(std::uint32_t) + sizeof(std::size_t);
+
+			/**
+			 * Largest original size accepted when decompressing (guards allocations).
+			 */
+			static constexpr std::size_t MAX_BLOCK_SIZE = std::size_t(1) << 30;
+
+			/**
+			 * @param options Compression options (algorithm must be available).
+			 */
+			explicit Codec(const Compression::Options& options) noexcept;
+
+			/**
+			 * Copy constructor (deleted).
+			 */
+			Codec(const Codec& other) = delete;
+
+			/**
+			 * Move constructor (deleted).
+			 */
+			Codec(Codec&& other) noexcept = delete;
+
+			/**
+			 * Destructor (releases prepared dictionaries).
+			 */
+			~Codec() noexcept;
+
+			/**
+			 * Copy assignment (deleted).
+			 */
+			Codec& operator=(const Codec& other) = delete;
+
+			/**
+			 * Move assignment (deleted).
+			 */
+			Codec& operator=(Codec&& other) noexcept = delete;
+
+			/**
+			 * @return Outbound algorithm.
+			 */
+			inline const Compression::Algorithm& Algorithm() const noexcept {
+				return m_algorithm;
+			}
+
+			/**
+			 * @return Dictionary ID of every opcode with a dictionary.
+			 */
+			std::unordered_map<Packet::OpcodeType, std::uint32_t> DictionaryIDs() const noexcept;
+
+			/**
+			 * Builds a codec for sending to a specific peer, sharing the
+			 * prepared dictionaries.
+			 * @param algorithms Algorithms the peer decodes (bit = 1 << Algorithm).
+			 * @param dictionaries Dictionaries both sides agree on (opcode -> ID).
+			 * @return Codec falling back to no compression if the peer cannot
+			 * decode the outbound algorithm, using only agreed dictionaries.
+			 */
+			std::shared_ptr<const Codec> Restrict(const std::uint8_t& algorithms, const std::unordered_map<Packet::OpcodeType, std::uint32_t>& dictionaries) const noexcept;
+
+			/**
+			 * @param other Codec to compare with.
+			 * @param opcode Packet opcode.
+			 * @return true if both codecs produce identical blocks for @p opcode.
+			 */
+			bool EncodesLike(const Codec& other, const Packet::OpcodeType& opcode) const noexcept;
+
+			/**
+			 * @param size Payload size.
+			 * @return true if payloads of @p size are worth compressing.
+			 */
+			inline bool ShouldCompress(const std::size_t& size) const noexcept {
+				return m_algorithm != Compression::Algorithm::None && size >= m_min_size;
+			}
+
+			/**
+			 * Compresses @p data into a block, using the dictionary of @p opcode if any.
+			 * @param opcode Packet opcode.
+			 * @param data Uncompressed bytes.
+			 * @return Block; stored uncompressed if compression fails or does not shrink it.
+			 */
+			Buffer::DataType Compress(const Packet::OpcodeType& opcode, std::span<const std::byte> data) const noexcept;
+
+			/**
+			 * Decompresses a block produced by @ref Compress().
+			 * @param opcode Packet opcode (selects the dictionary).
+			 * @param block Block bytes.
+			 * @param max_size Largest original size accepted; checked against
+			 * the block header before anything is allocated (capped at
+			 * @ref MAX_BLOCK_SIZE).
+			 * @return Original bytes or FrameError on malformed / mismatched / oversized block.
+			 */
+			Expected<Buffer::DataType, FrameError> Decompress(const Packet::OpcodeType& opcode, std::span<const std::byte> block, const std::size_t& max_size) const noexcept;
+
+		private:
+			struct Dictionary;	///< Prepared dictionary (defined in codec.cxx)
+
+			Compression::Algorithm m_algorithm;												///< Outbound algorithm
+			int m_level;																	///< Codec level
+			std::size_t m_min_size;															///< Compression threshold
+			std::unordered_map<Packet::OpcodeType, std::shared_ptr<const Dictionary>> m_dictionaries;	///< Per-opcode dictionaries
+
+			/**
+			 * Empty codec (filled by @ref Restrict()).
+			 */
+			Codec() noexcept = default;
+
+			/**
+			 * @param opcode Packet opcode.
+			 * @return Dictionary for @p opcode, or nullptr.
+			 */
+			const Dictionary* Find(const Packet::OpcodeType& opcode) const noexcept;
+	};
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <StormByte/network/transport/control.hxx>
+
+/**
+ * @namespace Transport
+ * @brief Application-layer messages (Packet, Frame) and on-wire layout.
+ */
+namespace StormByte::Network::Transport {
+	/**
+	 * @class ControlPacket
+	 * @brief Library control frame carrying pre-serialized bytes.
+	 */
+	class STORMBYTE_NETWORK_PRIVATE ControlPacket final: public Packet {
+		public:
+			/**
+			 * @param control Control opcode.
+			 * @param payload Serialized payload (may be empty).
+			 */
+			ControlPacket(const Control& control, Buffer::DataType&& payload = {}) noexcept:
+			Packet(static_cast<OpcodeType>(control)),
+			m_payload(std::move(payload)) {}
+
+			/**
+			 * Copy constructor.
+			 */
+			ControlPacket(const ControlPacket& other) = default;
+
+			/**
+			 * Move constructor.
+			 */
+			ControlPacket(ControlPacket&& other) noexcept = default;
+
+			/**
+			 * Destructor.
+			 */
+			~ControlPacket() noexcept override = default;
+
+			/**
+			 * Copy assignment.
+			 */
+			ControlPacket& operator=(const ControlPacket& other) = default;
+
+			/**
+			 * Move assignment.
+			 */
+			ControlPacket& operator=(ControlPacket&& other) noexcept = default;
+
+		private:
+			Buffer::DataType m_payload;	///< Payload bytes
+
+			/**
+			 * @return Copy of the payload.
+			 */
+			Buffer::DataType DoSerialize() const noexcept override {
+				return m_payload;
+			}
+	};
+}
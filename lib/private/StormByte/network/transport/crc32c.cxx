@@ -0,0 +1,149 @@
+#include <StormByte/network/transport/crc32c.hxx>
+
+#include <array>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+	#define STORMBYTE_CRC32C_X86
+	#include <nmmintrin.h>
+	#ifdef _MSC_VER
+		#include <intrin.h>
+		#define STORMBYTE_CRC32C_TARGET
+	#else
+		#define STORMBYTE_CRC32C_TARGET __attribute__((target("sse4.2")))
+	#endif
+#elif defined(__ARM_FEATURE_CRC32)
+	#define STORMBYTE_CRC32C_ARM
+	#include <arm_acle.h>
+#endif
+
+using namespace StormByte::Network::Transport;
+
+namespace {
+	using UpdateFunction = std::uint32_t (*)(std::uint32_t, const std::byte*, std::size_t) noexcept;
+
+	constexpr std::uint32_t POLYNOMIAL = 0x82F63B78u;	///< Reflected Castagnoli polynomial
+
+	/**
+	 * Slicing-by-8 lookup tables.
+	 */
+	constexpr std::array<std::array<std::uint32_t, 256>, 8> MakeTables() noexcept {
+		std::array<std::array<std::uint32_t, 256>, 8> tables {};
+		for (std::uint32_t i = 0; i < 256; ++i) {
+			std::uint32_t crc = i;
+			for (int bit = 0; bit < 8; ++bit)
+				crc = (crc & 1) ? (crc >> 1) ^ POLYNOMIAL : crc >> 1;
+			tables[0][i] = crc;
+		}
+		for (std::size_t i = 0; i < 256; ++i) {
+			for (std::size_t slice = 1; slice < 8; ++slice)
+				tables[slice][i] = (tables[slice - 1][i] >> 8) ^ tables[0][tables[slice - 1][i] & 0xFF];
+		}
+		return tables;
+	}
+
+	constexpr auto TABLES = MakeTables();
+
+	inline std::uint32_t LoadLE32(const std::byte* p) noexcept {
+		return static_cast<std::uint32_t>(p[0])
+			| (static_cast<std::uint32_t>(p[1]) << 8)
+			| (static_cast<std::uint32_t>(p[2]) << 16)
+			| (static_cast<std::uint32_t>(p[3]) << 24);
+	}
+
+	std::uint32_t UpdateTable(std::uint32_t crc, const std::byte* data, std::size_t size) noexcept {
+		while (size >= 8) {
+			const std::uint32_t one = LoadLE32(data) ^ crc;
+			const std::uint32_t two = LoadLE32(data + 4);
+			crc = TABLES[7][one & 0xFF] ^ TABLES[6][(one >> 8) & 0xFF] ^ TABLES[5][(one >> 16) & 0xFF] ^ TABLES[4][one >> 24]
+				^ TABLES[3][two & 0xFF] ^ TABLES[2][(two >> 8) & 0xFF] ^ TABLES[1][(two >> 16) & 0xFF] ^ TABLES[0][two >> 24];
+			data += 8;
+			size -= 8;
+		}
+		while (size-- > 0)
+			crc = (crc >> 8) ^ TABLES[0][(crc ^ static_cast<std::uint32_t>(*data++)) & 0xFF];
+		return crc;
+	}
+
+#ifdef STORMBYTE_CRC32C_X86
+	STORMBYTE_CRC32C_TARGET std::uint32_t UpdateSSE42(std::uint32_t crc, const std::byte* data, std::size_t size) noexcept {
+#if defined(__x86_64__) || defined(_M_X64)
+		std::uint64_t crc64 = crc;
+		while (size >= 8) {
+			std::uint64_t word;
+			std::memcpy(&word, data, sizeof(word));
+			crc64 = _mm_crc32_u64(crc64, word);
+			data += 8;
+			size -= 8;
+		}
+		crc = static_cast<std::uint32_t>(crc64);
+#endif
+		while (size >= 4) {
+			std::uint32_t word;
+			std::memcpy(&word, data, sizeof(word));
+			crc = _mm_crc32_u32(crc, word);
+			data += 4;
+			size -= 4;
+		}
+		while (size-- > 0)
+			crc = _mm_crc32_u8(crc, static_cast<unsigned char>(*data++));
+		return crc;
+	}
+
+	bool HasSSE42() noexcept {
+#ifdef _MSC_VER
+		int info[4];
+		__cpuid(info, 1);
+		return (info[2] & (1 << 20)) != 0;
+#else
+		return __builtin_cpu_supports("sse4.2");
+#endif
+	}
+#endif
+
+#ifdef STORMBYTE_CRC32C_ARM
+	std::uint32_t UpdateARM(std::uint32_t crc, const std::byte* data, std::size_t size) noexcept {
+		while (size >= 8) {
+			std::uint64_t word;
+			std::memcpy(&word, data, sizeof(word));
+			crc = __crc32cd(crc, word);
+			data += 8;
+			size -= 8;
+		}
+		while (size-- > 0)
+			crc = __crc32cb(crc, static_cast<std::uint8_t>(*data++));
+		return crc;
+	}
+#endif
+
+	UpdateFunction SelectUpdate() noexcept {
+#if defined(STORMBYTE_CRC32C_X86)
+		if (HasSSE42())
+			return &UpdateSSE42;
+#elif defined(STORMBYTE_CRC32C_ARM)
+		return &UpdateARM;
+#endif
+		return &UpdateTable;
+	}
+
+	const UpdateFunction update = SelectUpdate();	///< Selected once at load time
+}
+
+void CRC32C::Update(std::span<const std::byte> data) noexcept {
+	if (!data.empty())
+		m_state = update(m_state, data.data(), data.size());
+}
+
+std::uint32_t CRC32C::Compute(std::span<const std::byte> data) noexcept {
+	CRC32C crc;
+	crc.Update(data);
+	return crc.Value();
+}
+
+std::uint32_t CRC32C::ComputePortable(std::span<const std::byte> data) noexcept {
+	return ~UpdateTable(0xFFFFFFFFu, data.data(), data.size());
+}
+
+bool CRC32C::Accelerated() noexcept {
+	return update != &UpdateTable;
+}
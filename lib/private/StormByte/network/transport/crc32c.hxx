@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <StormByte/network/visibility.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+/**
+ * @namespace Transport
+ * @brief Application-layer messages (Packet, Frame) and on-wire layout.
+ */
+namespace StormByte::Network::Transport {
+	/**
+	 * @class CRC32C
+	 * @brief Incremental CRC32C (Castagnoli) checksum.
+	 *
+	 * Uses the SSE4.2 CRC32 instruction when the CPU has it (checked once at
+	 * runtime), the ARMv8 CRC32 instructions when the build targets them, and
+	 * a portable slicing-by-8 table implementation otherwise.
+	 */
+	class STORMBYTE_NETWORK_PRIVATE CRC32C final {
+		public:
+			/**
+			 * Starts an empty checksum.
+			 */
+			constexpr CRC32C() noexcept:
+			m_state(0xFFFFFFFFu) {}
+
+			/**
+			 * Feeds more bytes.
+			 * @param data Bytes to add.
+			 */
+			void Update(std::span<const std::byte> data) noexcept;
+
+			/**
+			 * @return Checksum of every byte fed so far.
+			 */
+			constexpr std::uint32_t Value() const noexcept {
+				return ~m_state;
+			}
+
+			/**
+			 * @param data Bytes to checksum.
+			 * @return CRC32C of @p data.
+			 */
+			static std::uint32_t Compute(std::span<const std::byte> data) noexcept;
+
+			/**
+			 * Table implementation, whatever the CPU supports; the reference
+			 * the accelerated ones must match.
+			 * @param data Bytes to checksum.
+			 * @return CRC32C of @p data.
+			 */
+			static std::uint32_t ComputePortable(std::span<const std::byte> data) noexcept;
+
+			/**
+			 * @return true if a hardware implementation is in use.
+			 */
+			static bool Accelerated() noexcept;
+
+		private:
+			std::uint32_t m_state;	///< Running (inverted) CRC
+	};
+}
@@ -1,29 +1,109 @@
+#include <StormByte/network/executor/pool.hxx>
 #include <StormByte/network/socket/client.hxx>
+#include <StormByte/network/transport/crc32c.hxx>
 #include <StormByte/network/transport/frame.hxx>
 #include <StormByte/serializable.hxx>
 
+#include <algorithm>
+#include <functional>
+#include <future>
+#include <optional>
+#include <span>
+
 using StormByte::Buffer::Consumer;
 using StormByte::Buffer::DataType;
-using StormByte::Buffer::FIFO;
 using StormByte::Buffer::Pipeline;
 using StormByte::Buffer::Producer;
+using StormByte::Network::Executor::Pool;
 using StormByte::Network::PacketPointer;
 using namespace StormByte::Network::Transport;
 
-Frame::Frame(const Packet& packet) noexcept {
-	FIFO packet_raw = packet.Serialize();
-	m_opcode = packet.Opcode();
+namespace {
+	/**
+	 * Runs @p payload through @p pipeline in Sync mode on the calling thread.
+	 */
+	DataType ProcessSync(Pipeline& pipeline, DataType&& payload, std::shared_ptr<StormByte::Logger::Log> logger) noexcept {
+		Producer payload_producer;
+		payload_producer.Write(std::move(payload));
+		payload_producer.Close();
+
+		DataType processed;
+		Consumer processed_payload = pipeline.Process(payload_producer.Consumer(), StormByte::Buffer::ExecutionMode::Sync, logger);
+		processed_payload.ExtractUntilEoF(processed);
+		return processed;
+	}
+
+	/**
+	 * Runs @p payload through @p pipeline and collects the result.
+	 *
+	 * Stages always execute in Sync mode so no per-stage threads are created.
+	 * Small payloads run inline on the caller; larger ones run on the shared
+	 * executor pool, which bounds concurrent pipeline work to the core count.
+	 */
+	DataType RunPipeline(Pipeline& pipeline, DataType&& payload, std::shared_ptr<StormByte::Logger::Log> logger) noexcept {
+		if (payload.size() <= Frame::SYNC_PIPELINE_THRESHOLD || Pool::Instance().IsWorker())
+			return ProcessSync(pipeline, std::move(payload), logger);
+
+		return Pool::Instance().Submit([&pipeline, &logger, input = std::move(payload)]() mutable {
+			return ProcessSync(pipeline, std::move(input), logger);
+		}).get();
+	}
+
+	/**
+	 * Applies @p process to every chunk, in parallel on the shared executor
+	 * pool, and returns the results in chunk order.
+	 */
+	template <typename F>
+	auto ForEachChunk(const std::vector<std::span<const std::byte>>& chunks, F&& process) noexcept {
+		using Result = std::invoke_result_t<F&, std::span<const std::byte>>;
+		std::vector<Result> results;
+		results.reserve(chunks.size());
+
+		if (Pool::Instance().IsWorker()) {
+			for (const auto& chunk : chunks)
+				results.push_back(process(chunk));
+			return results;
+		}
 
-	// Drop opcode data, we already have it
-	packet_raw.Drop(sizeof(Packet::OpcodeType));
+		std::vector<std::future<Result>> pending;
+		pending.reserve(chunks.size());
+		for (const auto& chunk : chunks)
+			pending.push_back(Pool::Instance().Submit([&process, chunk] { return process(chunk); }));
 
-	// Read payload if not empty
-	if (packet_raw.AvailableBytes() > 0) {
-		packet_raw.Read(0, m_payload);
+		for (auto& future : pending)
+			results.push_back(future.get());
+		return results;
 	}
+
+	/**
+	 * Reads a serialized size_t at @p offset of @p data.
+	 * @return Value, or std::nullopt if @p data is too short.
+	 */
+	std::optional<std::size_t> ReadSize(const DataType& data, std::size_t offset) noexcept {
+		if (offset > data.size() || data.size() - offset < sizeof(std::size_t))
+			return std::nullopt;
+
+		auto expected_size = StormByte::Serializable<std::size_t>::Deserialize(
+			DataType(data.begin() + offset, data.begin() + offset + sizeof(std::size_t)));
+		if (!expected_size)
+			return std::nullopt;
+		return expected_size.value();
+	}
+}
+
+// Payload straight from the packet: no opcode round trip through a FIFO
+Frame::Frame(const Packet& packet) noexcept:
+	m_opcode(packet.Opcode()),
+	m_payload(packet.DoSerialize()) {}
+
+Frame Frame::ProcessInput(std::shared_ptr<Socket::Client> client, Buffer::Pipeline& in_pipeline, const Codec& codec, const std::uint32_t& features, const std::size_t& max_payload_size, std::shared_ptr<Logger::Log> logger) noexcept {
+	Frame frame = Read(client, features, max_payload_size, logger);
+	if (!frame.Decode(in_pipeline, codec, max_payload_size, logger))
+		return Frame();
+	return frame;
 }
 
-Frame Frame::ProcessInput(std::shared_ptr<Socket::Client> client, Buffer::Pipeline& in_pipeline, std::shared_ptr<Logger::Log> logger) noexcept {
+Frame Frame::Read(std::shared_ptr<Socket::Client> client, const std::uint32_t& features, const std::size_t& max_payload_size, std::shared_ptr<Logger::Log> logger) noexcept {
 	// Read opcode
 	ExpectedBuffer expected_opcode_buffer = client->Receive(sizeof(Packet::OpcodeType));
 	if (!expected_opcode_buffer) {
@@ -38,40 +118,121 @@ Frame Frame::ProcessInput(std::shared_ptr<Socket::Client> client, Buffer::Pipeli
 	}
 	const Packet::OpcodeType opcode = *expected_opcode;
 
-	// Read payload size
+	// Read payload size (top byte carries frame flags)
 	ExpectedBuffer expected_size_buffer = client->Receive(sizeof(std::size_t));
 	if (!expected_size_buffer) {
 		logger << Logger::Level::Error << "Failed to read payload size from socket: " << expected_size_buffer.error()->what() << std::endl;
 		return Frame();
 	}
-	auto expected_payload_size = Serializable<std::size_t>::Deserialize(expected_size_buffer->Data());
-	if (!expected_payload_size) {
+	auto expected_size_word = Serializable<std::size_t>::Deserialize(expected_size_buffer->Data());
+	if (!expected_size_word) {
 		logger << Logger::Level::Error << "Failed to deserialize payload size from socket: insufficient data" << std::endl;
 		return Frame();
 	}
-	const std::size_t payload_size = expected_payload_size.value();
+	const std::size_t payload_size = expected_size_word.value() & SIZE_MASK;
+	const std::uint8_t flags = static_cast<std::uint8_t>(expected_size_word.value() >> FLAGS_SHIFT);
 	DataType payload;
 
-	if (payload_size > 0) {
-		// Direct into vector — no intermediate FIFO of payload_size
-		payload.reserve(payload_size);
-		auto into = client->ReceiveInto(payload_size, payload);
-		if (!into) {
-			logger << Logger::Level::Error << "Failed to read full frame from socket: " << into.error()->what() << std::endl;
+	if (max_payload_size > 0 && payload_size > max_payload_size) {
+		logger << Logger::Level::Error << "Rejecting frame: payload of " << payload_size << " bytes exceeds limit of " << max_payload_size << std::endl;
+		return Frame();
+	}
+
+	const bool checksum = HasFlag(flags, Flag::Checksum);
+	if (checksum && payload_size < CHECKSUM_SIZE) {
+		logger << Logger::Level::Error << "Rejecting frame: too short for its checksum" << std::endl;
+		return Frame();
+	}
+
+	if (payload_size == 0)
+		return Frame(opcode, std::move(payload));
+
+	const bool processed = IsProcessed(opcode, features);
+	CRC32C crc;
+
+	// Unprocessed payloads are checksummed as chunks arrive, saving a second pass
+	const std::size_t data_size = checksum ? payload_size - CHECKSUM_SIZE : payload_size;
+	std::size_t received = 0;
+	const std::function<void(std::span<const std::byte>)> on_chunk = [&crc, &received, data_size](std::span<const std::byte> chunk) {
+		if (received < data_size)
+			crc.Update(chunk.first(std::min(chunk.size(), data_size - received)));
+		received += chunk.size();
+	};
+
+	// Direct into vector — no intermediate FIFO of payload_size
+	payload.reserve(payload_size);
+	auto into = (checksum && !processed)
+		? client->ReceiveInto(payload_size, payload, on_chunk)
+		: client->ReceiveInto(payload_size, payload);
+	if (!into) {
+		logger << Logger::Level::Error << "Failed to read full frame from socket: " << into.error()->what() << std::endl;
+		return Frame();
+	}
+
+	std::uint32_t expected_crc = 0;
+	if (checksum) {
+		auto expected_trailer = Serializable<std::uint32_t>::Deserialize(DataType(payload.end() - CHECKSUM_SIZE, payload.end()));
+		if (!expected_trailer) {
+			logger << Logger::Level::Error << "Failed to deserialize frame checksum" << std::endl;
 			return Frame();
 		}
+		expected_crc = expected_trailer.value();
+		payload.resize(data_size);
+	}
 
-		if (opcode >= Packet::PROCESS_THRESHOLD) {
-			Producer payload_producer;
-			payload_producer.Write(std::move(payload));
-			payload_producer.Close();
-			Consumer processed_payload = in_pipeline.Process(payload_producer.Consumer(), Buffer::ExecutionMode::Async, logger);
-			payload.clear();
-			processed_payload.ExtractUntilEoF(payload);
+	if (!processed) {
+		if (checksum && crc.Value() != expected_crc) {
+			logger << Logger::Level::Error << "Frame checksum mismatch (opcode " << opcode << ")" << std::endl;
+			return Frame();
 		}
+		return Frame(opcode, std::move(payload));
 	}
 
-	return Frame(opcode, std::move(payload));
+	// Pipelines, codec and the checksum are left to Decode()
+	Frame frame(opcode, std::move(payload));
+	frame.m_encoded = true;
+	frame.m_flags = flags;
+	frame.m_crc = expected_crc;
+	return frame;
+}
+
+bool Frame::Decode(Buffer::Pipeline& in_pipeline, const Codec& codec, const std::size_t& max_payload_size, std::shared_ptr<Logger::Log> logger) noexcept {
+	if (!m_encoded)
+		return true;
+	m_encoded = false;
+
+	const std::size_t max_size = max_payload_size > 0 ? max_payload_size : Codec::MAX_BLOCK_SIZE;
+	if (HasFlag(m_flags, Flag::Chunked)) {
+		auto expected_payload = Unchunk(in_pipeline, codec, HasFlag(m_flags, Flag::Compressed), m_opcode, m_payload, max_size, logger);
+		if (!expected_payload) {
+			logger << Logger::Level::Error << "Failed to process chunked frame: " << expected_payload.error()->what() << std::endl;
+			return false;
+		}
+		m_payload = std::move(expected_payload.value());
+	}
+	else {
+		m_payload = RunPipeline(in_pipeline, std::move(m_payload), logger);
+		if (HasFlag(m_flags, Flag::Compressed)) {
+			// Senders chunk every payload of PARALLEL_THRESHOLD bytes or more, so larger blocks are forged
+			auto expected_payload = codec.Decompress(m_opcode, m_payload, std::min(max_size, PARALLEL_THRESHOLD));
+			if (!expected_payload) {
+				logger << Logger::Level::Error << "Failed to decompress frame: " << expected_payload.error()->what() << std::endl;
+				return false;
+			}
+			m_payload = std::move(expected_payload.value());
+		}
+	}
+
+	// Checked after the input pipeline so faulty stages are caught too
+	if (HasFlag(m_flags, Flag::Checksum)) {
+		CRC32C crc;
+		crc.Update(m_payload);
+		if (crc.Value() != m_crc) {
+			logger << Logger::Level::Error << "Frame checksum mismatch (opcode " << m_opcode << ")" << std::endl;
+			return false;
+		}
+	}
+	return true;
 }
 
 PacketPointer Frame::ProcessPacket(const DeserializePacketFunction& packet_fn, std::shared_ptr<Logger::Log> logger) noexcept {
@@ -82,28 +243,134 @@ PacketPointer Frame::ProcessPacket(const DeserializePacketFunction& packet_fn, s
 	return packet_fn(m_opcode, payload_producer.Consumer(), logger);
 }
 
-Consumer Frame::ProcessOutput(Buffer::Pipeline& pipeline, std::shared_ptr<Logger::Log> logger) noexcept {
+Consumer Frame::ProcessOutput(Buffer::Pipeline& pipeline, const Codec& codec, const std::uint8_t& allowed_flags, const std::uint32_t& features, std::shared_ptr<Logger::Log> logger) noexcept {
 	Producer producer;
 
 	producer.Write(sizeof(Packet::OpcodeType), Serializable<Packet::OpcodeType>(m_opcode).Serialize());
 
 	DataType payload = std::move(m_payload);
+	std::uint8_t flags = static_cast<std::uint8_t>(Flag::None);
 
-	if (m_opcode >= Packet::PROCESS_THRESHOLD) {
-		Producer payload_producer;
-		payload_producer.Write(std::move(payload));
-		payload_producer.Close();
-		Consumer processed_payload = pipeline.Process(payload_producer.Consumer(), Buffer::ExecutionMode::Async, logger);
-		payload.clear();
-		processed_payload.ExtractUntilEoF(payload);
+	const bool compression_allowed = HasFlag(allowed_flags, Flag::Compressed);
+
+	// Checksum covers the payload the application sees, before compression and pipelines
+	const bool checksum = HasFlag(allowed_flags, Flag::Checksum);
+	const std::uint32_t crc = checksum ? CRC32C::Compute(payload) : 0;
+	if (checksum)
+		SetFlag(flags, Flag::Checksum);
+
+	const bool processed = IsProcessed(m_opcode, features);
+	if (processed && payload.size() >= PARALLEL_THRESHOLD && HasFlag(allowed_flags, Flag::Chunked)) {
+		// Chunk table (count + per-chunk sizes) followed by the processed chunks
+		std::vector<std::span<const std::byte>> chunks;
+		for (std::size_t offset = 0; offset < payload.size(); offset += PARALLEL_CHUNK_SIZE) {
+			chunks.emplace_back(payload.data() + offset, std::min(PARALLEL_CHUNK_SIZE, payload.size() - offset));
+		}
+
+		SetFlag(flags, Flag::Chunked);
+		const bool compress = compression_allowed && codec.ShouldCompress(PARALLEL_CHUNK_SIZE);
+		if (compress)
+			SetFlag(flags, Flag::Compressed);
+
+		// Each chunk gets a pipeline copy so stateful stages never run concurrently
+		std::vector<DataType> processed = ForEachChunk(chunks, [&](std::span<const std::byte> chunk) {
+			Pipeline chunk_pipeline = pipeline;
+			return ProcessSync(chunk_pipeline, compress ? codec.Compress(m_opcode, chunk) : DataType(chunk.begin(), chunk.end()), logger);
+		});
+
+		DataType table = Serializable<std::size_t>(processed.size()).Serialize();
+		std::size_t total = sizeof(std::size_t) * (processed.size() + 1);
+		for (const auto& chunk : processed) {
+			const DataType chunk_size = Serializable<std::size_t>(chunk.size()).Serialize();
+			table.insert(table.end(), chunk_size.begin(), chunk_size.end());
+			total += chunk.size();
+		}
+
+		if (checksum)
+			total += CHECKSUM_SIZE;
+
+		producer.Write(sizeof(std::size_t), Serializable<std::size_t>(EncodeSize(total, flags)).Serialize());
+		producer.Write(std::move(table));
+		for (auto& chunk : processed) {
+			if (!chunk.empty())
+				producer.Write(std::move(chunk));
+		}
+		if (checksum)
+			producer.Write(Serializable<std::uint32_t>(crc).Serialize());
+
+		producer.Close();
+		return producer.Consumer();
 	}
 
-	producer.Write(sizeof(std::size_t), Serializable<std::size_t>(payload.size()).Serialize());
+	if (processed) {
+		if (compression_allowed && codec.ShouldCompress(payload.size())) {
+			DataType block = codec.Compress(m_opcode, payload);
+			// Stored blocks only add a header, send those payloads as they are
+			if (block.size() < payload.size()) {
+				payload = std::move(block);
+				SetFlag(flags, Flag::Compressed);
+			}
+		}
+		payload = RunPipeline(pipeline, std::move(payload), logger);
+	}
+
+	producer.Write(sizeof(std::size_t), Serializable<std::size_t>(EncodeSize(payload.size() + (checksum ? CHECKSUM_SIZE : 0), flags)).Serialize());
 
 	if (!payload.empty()) {
 		producer.Write(std::move(payload));
 	}
+	if (checksum) {
+		producer.Write(Serializable<std::uint32_t>(crc).Serialize());
+	}
 
 	producer.Close();
 	return producer.Consumer();
 }
+
+StormByte::Expected<DataType, StormByte::Network::FrameError> Frame::Unchunk(Buffer::Pipeline& pipeline, const Codec& codec, const bool& compressed, const Packet::OpcodeType& opcode, const DataType& payload, const std::size_t& max_size, std::shared_ptr<Logger::Log> logger) noexcept {
+	auto chunk_count = ReadSize(payload, 0);
+	if (!chunk_count || *chunk_count > payload.size() / sizeof(std::size_t))
+		return Unexpected<FrameError>("Invalid chunk count");
+	// Every compressed chunk may expand to a full chunk: bound the total before decompressing any
+	if (compressed && *chunk_count > (max_size + PARALLEL_CHUNK_SIZE - 1) / PARALLEL_CHUNK_SIZE)
+		return Unexpected<FrameError>("Too many chunks ({}) for a payload limit of {} bytes", *chunk_count, max_size);
+
+	std::size_t offset = sizeof(std::size_t) * (*chunk_count + 1);
+	if (offset > payload.size())
+		return Unexpected<FrameError>("Truncated chunk table");
+
+	std::vector<std::span<const std::byte>> chunks;
+	chunks.reserve(*chunk_count);
+	for (std::size_t i = 0; i < *chunk_count; ++i) {
+		auto chunk_size = ReadSize(payload, sizeof(std::size_t) * (i + 1));
+		if (!chunk_size || *chunk_size > payload.size() - offset)
+			return Unexpected<FrameError>("Chunk {} exceeds frame payload", i);
+		chunks.emplace_back(payload.data() + offset, *chunk_size);
+		offset += *chunk_size;
+	}
+
+	if (offset != payload.size())
+		return Unexpected<FrameError>("Chunk sizes do not match frame payload ({} of {} bytes)", offset, payload.size());
+
+	// Each chunk gets a pipeline copy so stateful stages never run concurrently
+	auto processed = ForEachChunk(chunks, [&](std::span<const std::byte> chunk) -> Expected<DataType, FrameError> {
+		Pipeline chunk_pipeline = pipeline;
+		DataType data = ProcessSync(chunk_pipeline, DataType(chunk.begin(), chunk.end()), logger);
+		if (!compressed)
+			return data;
+		return codec.Decompress(opcode, data, PARALLEL_CHUNK_SIZE);
+	});
+
+	std::size_t total = 0;
+	for (const auto& chunk : processed) {
+		if (!chunk)
+			return Unexpected(chunk.error());
+		total += chunk->size();
+	}
+
+	DataType result;
+	result.reserve(total);
+	for (const auto& chunk : processed)
+		result.insert(result.end(), chunk->begin(), chunk->end());
+	return result;
+}
@@ -20,9 +20,14 @@
 #pragma once
 
 #include <StormByte/buffer/pipeline.hxx>
+#include <StormByte/network/connection/capabilities.hxx>
+#include <StormByte/network/transport/codec.hxx>
+#include <StormByte/network/transport/control.hxx>
 #include <StormByte/network/transport/packet.hxx>
 #include <StormByte/network/typedefs.hxx>
 
+#include <cstdint>
+
 namespace StormByte::Network::Socket {
 	class Client;	///< Forward declaration
 }
@@ -38,13 +43,61 @@ namespace StormByte::Network::Transport {
 	 *
 	 * Layout:
 	 * - Opcode: sizeof(Packet::OpcodeType)
-	 * - Payload size: sizeof(std::size_t)
+	 * - Payload size: sizeof(std::size_t); the top byte holds @ref Flag bits
 	 * - Payload: variable (may be empty)
 	 *
-	 * Opcodes >= Packet::PROCESS_THRESHOLD run payload through pipelines.
+	 * Opcodes >= Packet::PROCESS_THRESHOLD run payload through pipelines,
+	 * and so do @ref Control::Batch / @ref Control::Publish frames once the
+	 * peer negotiated the related feature (see @ref IsProcessed()); for
+	 * other peers they are plain application opcodes.
+	 * Pipelines run in Sync mode: inline for payloads up to
+	 * @ref SYNC_PIPELINE_THRESHOLD, on the shared Executor::Pool otherwise.
+	 * Payloads of at least @ref PARALLEL_THRESHOLD bytes are split into
+	 * @ref PARALLEL_CHUNK_SIZE chunks processed in parallel and sent as a
+	 * @ref Flag::Chunked frame: chunk count, per-chunk sizes, then the chunks.
+	 * With @ref Flag::Compressed the payload (or every chunk) is a Codec block,
+	 * compressed before the output pipeline and decompressed after the input one.
+	 * With @ref Flag::Checksum a CRC32C of the unprocessed payload follows it
+	 * (included in the payload size) and is verified after decoding.
 	 */
 	class STORMBYTE_NETWORK_PRIVATE Frame {
 		public:
+			/**
+			 * @enum Flag
+			 * @brief Frame header flags, stored in the top byte of the size field.
+			 *
+			 * Peers without flag support never set these bits, so their frames
+			 * decode unchanged. They would read the bits as part of the size, so
+			 * flags are only sent once the peer negotiated
+			 * Connection::Feature::FrameFlags.
+			 */
+			enum class Flag: std::uint8_t {
+				None		= 0x00,	///< Plain payload
+				Chunked		= 0x01,	///< Payload split into independently processed chunks
+				Compressed	= 0x02,	///< Payload (or every chunk) is a Codec block
+				Checksum	= 0x04,	///< CRC32C trailer over the unprocessed payload
+			};
+
+			/**
+			 * Every @ref Flag this library understands.
+			 */
+			static constexpr std::uint8_t ALL_FLAGS = static_cast<std::uint8_t>(Flag::Chunked) | static_cast<std::uint8_t>(Flag::Compressed) | static_cast<std::uint8_t>(Flag::Checksum);
+
+			/**
+			 * Payloads up to this size run their pipeline inline on the caller.
+			 */
+			static constexpr std::size_t SYNC_PIPELINE_THRESHOLD = 64 * 1024;
+
+			/**
+			 * Chunk size used when splitting large payloads for parallel processing.
+			 */
+			static constexpr std::size_t PARALLEL_CHUNK_SIZE = 1024 * 1024;
+
+			/**
+			 * Payloads of at least this size are processed in parallel chunks.
+			 */
+			static constexpr std::size_t PARALLEL_THRESHOLD = 2 * PARALLEL_CHUNK_SIZE;
+
 			/**
 			 * Builds a frame from a packet (serializes payload, strips opcode from buffer).
 			 * @param packet Source packet.
@@ -80,10 +133,36 @@ namespace StormByte::Network::Transport {
 			 * Reads one frame from the socket (opcode, size, payload + optional pipeline).
 			 * @param client Socket client.
 			 * @param in_pipeline Input pipeline.
+			 * @param codec Codec for compressed payloads.
+			 * @param features Connection::Feature bits negotiated with the peer.
+			 * @param max_payload_size Largest payload accepted (0 = unlimited).
+			 * @param logger Logger.
+			 * @return Frame (default-constructed on failure).
+			 */
+			static Frame ProcessInput(std::shared_ptr<Socket::Client> client, Buffer::Pipeline& in_pipeline, const Codec& codec, const std::uint32_t& features, const std::size_t& max_payload_size, std::shared_ptr<Logger::Log> logger) noexcept;
+
+			/**
+			 * Reads one frame from the socket without decoding it: processed
+			 * payloads keep their wire form until @ref Decode(), so the
+			 * pipeline work can run on another thread.
+			 * @param client Socket client.
+			 * @param features Connection::Feature bits negotiated with the peer.
+			 * @param max_payload_size Largest payload accepted (0 = unlimited).
 			 * @param logger Logger.
 			 * @return Frame (default-constructed on failure).
 			 */
-			static Frame ProcessInput(std::shared_ptr<Socket::Client> client, Buffer::Pipeline& in_pipeline, std::shared_ptr<Logger::Log> logger) noexcept;
+			static Frame Read(std::shared_ptr<Socket::Client> client, const std::uint32_t& features, const std::size_t& max_payload_size, std::shared_ptr<Logger::Log> logger) noexcept;
+
+			/**
+			 * Runs a frame from @ref Read() through the input pipeline and
+			 * codec and verifies its checksum (no-op if already decoded).
+			 * @param in_pipeline Input pipeline.
+			 * @param codec Codec for compressed payloads.
+			 * @param max_payload_size Largest decompressed payload accepted (0 = unlimited).
+			 * @param logger Logger.
+			 * @return false if the payload could not be decoded.
+			 */
+			bool Decode(Buffer::Pipeline& in_pipeline, const Codec& codec, const std::size_t& max_payload_size, std::shared_ptr<Logger::Log> logger) noexcept;
 
 			/**
 			 * Deserializes payload into a Packet via @p packet_fn.
@@ -96,14 +175,112 @@ namespace StormByte::Network::Transport {
 			/**
 			 * Serializes this frame to a Consumer (opcode, size, payload + optional pipeline).
 			 * @param out_pipeline Output pipeline.
+			 * @param codec Codec used when the payload is worth compressing.
+			 * @param allowed_flags @ref Flag bits that may be used (peer support and local settings).
+			 * @param features Connection::Feature bits negotiated with the peer.
 			 * @param logger Logger.
 			 * @return Consumer of framed bytes.
 			 */
-			Buffer::Consumer ProcessOutput(Buffer::Pipeline& out_pipeline, std::shared_ptr<Logger::Log> logger) noexcept;
+			Buffer::Consumer ProcessOutput(Buffer::Pipeline& out_pipeline, const Codec& codec, const std::uint8_t& allowed_flags, const std::uint32_t& features, std::shared_ptr<Logger::Log> logger) noexcept;
+
+			/**
+			 * @return Opcode (0 for an empty frame).
+			 */
+			inline const Packet::OpcodeType& Opcode() const noexcept {
+				return m_opcode;
+			}
+
+			/**
+			 * @return Payload bytes.
+			 */
+			inline const Buffer::DataType& Payload() const noexcept {
+				return m_payload;
+			}
+
+			/**
+			 * @param opcode Frame opcode.
+			 * @param features Connection::Feature bits negotiated with the peer.
+			 * @return true if payloads with @p opcode run through pipelines and codecs.
+			 */
+			static constexpr bool IsProcessed(const Packet::OpcodeType& opcode, const std::uint32_t& features) noexcept {
+				if (opcode >= Packet::PROCESS_THRESHOLD)
+					return true;
+				// Peers without the feature use the opcode for plain application packets
+				return (IsControl(opcode, Control::Batch) && (features & static_cast<std::uint32_t>(Connection::Feature::Batch)) != 0)
+					|| (IsControl(opcode, Control::Publish) && (features & static_cast<std::uint32_t>(Connection::Feature::PubSub)) != 0);
+			}
+
+			/**
+			 * @return true if this frame packs several packets (see Batch);
+			 * only meaningful if the peer negotiated Connection::Feature::Batch.
+			 */
+			inline bool IsBatch() const noexcept {
+				return IsControl(m_opcode, Control::Batch);
+			}
+
+			/**
+			 * @return true if this frame carries a published packet (see Publication);
+			 * only meaningful if the peer negotiated Connection::Feature::PubSub.
+			 */
+			inline bool IsPublication() const noexcept {
+				return IsControl(m_opcode, Control::Publish);
+			}
 
 		private:
-			Packet::OpcodeType m_opcode;	///< Opcode
+			friend class Batch;
+			friend class Publication;
+
+			static constexpr unsigned int FLAGS_SHIFT = (sizeof(std::size_t) - 1) * 8;			///< Flag byte position
+			static constexpr std::size_t SIZE_MASK = (std::size_t(1) << FLAGS_SHIFT) - 1;		///< Payload size bits
+			static constexpr std::size_t CHECKSUM_SIZE = sizeof(std::uint32_t);					///< Checksum trailer size
+
+			Packet::OpcodeType m_opcode = 0;	///< Opcode
 			Buffer::DataType m_payload;		///< Payload bytes
+			bool m_encoded = false;			///< Payload still in wire form (see Read())
+			std::uint8_t m_flags = 0;			///< Received flags, pending Decode()
+			std::uint32_t m_crc = 0;			///< Received checksum, pending Decode()
+
+			/**
+			 * @param flags Raw flag byte.
+			 * @param flag Flag to test.
+			 * @return true if @p flag is set in @p flags.
+			 */
+			static constexpr bool HasFlag(const std::uint8_t& flags, const Flag& flag) noexcept {
+				return (flags & static_cast<std::uint8_t>(flag)) != 0;
+			}
+
+			/**
+			 * @param flags Raw flag byte (updated).
+			 * @param flag Flag to set.
+			 */
+			static constexpr void SetFlag(std::uint8_t& flags, const Flag& flag) noexcept {
+				flags |= static_cast<std::uint8_t>(flag);
+			}
+
+			/**
+			 * Packs payload size and flags into the on-wire size field.
+			 * @param size Payload size (must fit in the size bits).
+			 * @param flags Raw flag byte.
+			 * @return Size field value.
+			 */
+			static constexpr std::size_t EncodeSize(const std::size_t& size, const std::uint8_t& flags) noexcept {
+				return (size & SIZE_MASK) | (static_cast<std::size_t>(flags) << FLAGS_SHIFT);
+			}
+
+			/**
+			 * Splits a @ref Flag::Chunked payload and runs every chunk through
+			 * @p pipeline (and @p codec when @p compressed) in parallel,
+			 * reassembling the result in order.
+			 * @param pipeline Input pipeline.
+			 * @param codec Codec for compressed chunks.
+			 * @param compressed true if chunks are Codec blocks.
+			 * @param opcode Frame opcode (selects the dictionary).
+			 * @param payload Raw chunked payload.
+			 * @param max_size Largest decompressed payload accepted.
+			 * @param logger Logger.
+			 * @return Reassembled payload or FrameError on a malformed chunk table / block.
+			 */
+			static Expected<Buffer::DataType, FrameError> Unchunk(Buffer::Pipeline& pipeline, const Codec& codec, const bool& compressed, const Packet::OpcodeType& opcode, const Buffer::DataType& payload, const std::size_t& max_size, std::shared_ptr<Logger::Log> logger) noexcept;
 
 			/**
 			 * Empty frame (error path).
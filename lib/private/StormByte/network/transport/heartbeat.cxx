@@ -0,0 +1,34 @@
+#include <StormByte/network/transport/heartbeat.hxx>
+#include <StormByte/serializable.hxx>
+
+using StormByte::Buffer::DataType;
+using namespace StormByte::Network::Transport;
+
+namespace {
+	/**
+	 * @return Steady clock reading in microseconds.
+	 */
+	std::uint64_t Now() noexcept {
+		return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+	}
+}
+
+ControlPacket Heartbeat::Ping() noexcept {
+	return ControlPacket(Control::Ping, Serializable<std::uint64_t>(Now()).Serialize());
+}
+
+ControlPacket Heartbeat::Pong(const Frame& ping) noexcept {
+	return ControlPacket(Control::Pong, DataType(ping.Payload()));
+}
+
+StormByte::Expected<std::chrono::microseconds, StormByte::Network::FrameError> Heartbeat::RoundTrip(const Frame& pong) noexcept {
+	if (pong.Payload().size() != sizeof(std::uint64_t))
+		return Unexpected<FrameError>("Heartbeat of {} bytes, expected {}", pong.Payload().size(), sizeof(std::uint64_t));
+
+	auto expected_sent = Serializable<std::uint64_t>::Deserialize(pong.Payload());
+	if (!expected_sent)
+		return Unexpected<FrameError>("Malformed heartbeat");
+
+	const std::uint64_t now = Now();
+	return std::chrono::microseconds(now > expected_sent.value() ? now - expected_sent.value() : 0);
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <StormByte/network/exception.hxx>
+#include <StormByte/network/transport/control_packet.hxx>
+#include <StormByte/network/transport/frame.hxx>
+
+#include <chrono>
+
+/**
+ * @namespace Transport
+ * @brief Application-layer messages (Packet, Frame) and on-wire layout.
+ */
+namespace StormByte::Network::Transport {
+	/**
+	 * @class Heartbeat
+	 * @brief Builds and reads @ref Control::Ping / @ref Control::Pong frames.
+	 *
+	 * Payload layout:
+	 * - Send time: sizeof(std::uint64_t), microseconds of the sender's
+	 *   steady clock
+	 *
+	 * The peer echoes it unchanged, so only the sender's clock is used to
+	 * measure the round trip. Both opcodes are below
+	 * Packet::PROCESS_THRESHOLD and skip the pipelines.
+	 */
+	class STORMBYTE_NETWORK_PRIVATE Heartbeat final {
+		public:
+			/**
+			 * Static helpers only.
+			 */
+			Heartbeat() = delete;
+
+			/**
+			 * @return Ping stamped with the current time.
+			 */
+			static ControlPacket Ping() noexcept;
+
+			/**
+			 * @param ping Received ping frame.
+			 * @return Its echo.
+			 */
+			static ControlPacket Pong(const Frame& ping) noexcept;
+
+			/**
+			 * @param pong Received pong frame.
+			 * @return Time since its ping was sent, or FrameError if malformed.
+			 */
+			static Expected<std::chrono::microseconds, FrameError> RoundTrip(const Frame& pong) noexcept;
+	};
+}
@@ -0,0 +1,48 @@
+#include <StormByte/network/transport/publication.hxx>
+#include <StormByte/serializable.hxx>
+
+using StormByte::Buffer::DataType;
+using namespace StormByte::Network::Transport;
+
+StormByte::Expected<Frame, StormByte::Network::FrameError> Publication::Wrap(const std::string& topic, const Packet& packet) noexcept {
+	if (topic.size() > MAX_TOPIC_SIZE)
+		return Unexpected<FrameError>("Topic of {} bytes exceeds the {} bytes limit", topic.size(), MAX_TOPIC_SIZE);
+
+	const Frame frame(packet);
+	const DataType topic_size = Serializable<std::uint16_t>(static_cast<std::uint16_t>(topic.size())).Serialize();
+	const DataType opcode = Serializable<Packet::OpcodeType>(frame.m_opcode).Serialize();
+
+	DataType payload;
+	payload.reserve(topic_size.size() + topic.size() + opcode.size() + frame.m_payload.size());
+	payload.insert(payload.end(), topic_size.begin(), topic_size.end());
+	for (const char& c : topic)
+		payload.push_back(static_cast<std::byte>(c));
+	payload.insert(payload.end(), opcode.begin(), opcode.end());
+	payload.insert(payload.end(), frame.m_payload.begin(), frame.m_payload.end());
+	return Frame(static_cast<Packet::OpcodeType>(Control::Publish), std::move(payload));
+}
+
+StormByte::Expected<std::pair<std::string, Frame>, StormByte::Network::FrameError> Publication::Unwrap(const Frame& frame) noexcept {
+	const DataType& payload = frame.m_payload;
+	if (payload.size() < sizeof(std::uint16_t))
+		return Unexpected<FrameError>("Truncated publication header");
+
+	auto expected_topic_size = Serializable<std::uint16_t>::Deserialize(DataType(payload.begin(), payload.begin() + sizeof(std::uint16_t)));
+	if (!expected_topic_size)
+		return Unexpected<FrameError>("Malformed publication header");
+
+	const std::size_t topic_size = expected_topic_size.value();
+	std::size_t offset = sizeof(std::uint16_t);
+	if (payload.size() - offset < topic_size + sizeof(Packet::OpcodeType))
+		return Unexpected<FrameError>("Truncated publication of {} bytes", payload.size());
+
+	std::string topic(reinterpret_cast<const char*>(payload.data() + offset), topic_size);
+	offset += topic_size;
+
+	auto expected_opcode = Serializable<Packet::OpcodeType>::Deserialize(DataType(payload.begin() + offset, payload.begin() + offset + sizeof(Packet::OpcodeType)));
+	if (!expected_opcode)
+		return Unexpected<FrameError>("Malformed publication opcode");
+	offset += sizeof(Packet::OpcodeType);
+
+	return std::pair<std::string, Frame> { std::move(topic), Frame(expected_opcode.value(), DataType(payload.begin() + offset, payload.end())) };
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <StormByte/network/exception.hxx>
+#include <StormByte/network/transport/frame.hxx>
+
+#include <limits>
+#include <string>
+#include <utility>
+
+/**
+ * @namespace Transport
+ * @brief Application-layer messages (Packet, Frame) and on-wire layout.
+ */
+namespace StormByte::Network::Transport {
+	/**
+	 * @class Publication
+	 * @brief Wraps a packet published to a topic in a @ref Control::Publish frame.
+	 *
+	 * Payload layout:
+	 * - Topic size: sizeof(std::uint16_t)
+	 * - Topic: variable
+	 * - Opcode: sizeof(Packet::OpcodeType)
+	 * - Payload: rest of the frame (may be empty)
+	 *
+	 * The whole frame runs through the pipelines and codec like any
+	 * application frame.
+	 */
+	class STORMBYTE_NETWORK_PRIVATE Publication final {
+		public:
+			/**
+			 * Longest topic name.
+			 */
+			static constexpr std::size_t MAX_TOPIC_SIZE = std::numeric_limits<std::uint16_t>::max();
+
+			/**
+			 * Static helpers only.
+			 */
+			Publication() = delete;
+
+			/**
+			 * @param topic Topic name (at most @ref MAX_TOPIC_SIZE bytes).
+			 * @param packet Published packet.
+			 * @return Publish frame or FrameError if @p topic is too long.
+			 */
+			static Expected<Frame, FrameError> Wrap(const std::string& topic, const Packet& packet) noexcept;
+
+			/**
+			 * @param frame Received @ref Control::Publish frame.
+			 * @return Topic and the published packet frame, or FrameError if malformed.
+			 */
+			static Expected<std::pair<std::string, Frame>, FrameError> Unwrap(const Frame& frame) noexcept;
+	};
+}
@@ -0,0 +1,24 @@
+#include <StormByte/network/connection/client.hxx>
+#include <StormByte/network/transport/shared_frame.hxx>
+
+#include <algorithm>
+
+using StormByte::Buffer::DataType;
+using namespace StormByte::Network::Transport;
+
+SharedFrame::SharedFrame(Frame&& frame) noexcept:
+	m_frame(std::move(frame)),
+	m_encodings() {}
+
+std::shared_ptr<const DataType> SharedFrame::For(std::shared_ptr<Connection::Client> client, std::shared_ptr<Logger::Log> logger) noexcept {
+	auto encoding = std::find_if(m_encodings.begin(), m_encodings.end(), [this, &client](const Encoding& candidate) {
+		return client->EncodesLike(*candidate.prototype, m_frame.Opcode());
+	});
+	if (encoding != m_encodings.end())
+		return encoding->data;
+
+	Frame copy = m_frame;
+	auto data = std::make_shared<const DataType>(client->Encode(std::move(copy), logger));
+	m_encodings.push_back(Encoding { .prototype = client, .data = data });
+	return data;
+}
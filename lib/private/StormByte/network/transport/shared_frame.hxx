@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <StormByte/network/transport/frame.hxx>
+
+#include <memory>
+#include <vector>
+
+namespace StormByte::Network::Connection {
+	class Client;	///< Forward declaration
+}
+
+/**
+ * @namespace Transport
+ * @brief Application-layer messages (Packet, Frame) and on-wire layout.
+ */
+namespace StormByte::Network::Transport {
+	/**
+	 * @class SharedFrame
+	 * @brief One frame sent to many connections, encoded once per encoding.
+	 *
+	 * Connections negotiating the same frame flags and codec get the same
+	 * immutable on-wire bytes, so fan-out cost depends on the number of
+	 * distinct encodings instead of the number of recipients. Peers of one
+	 * endpoint rarely differ, so encodings are kept in a small vector.
+	 * Not thread-safe: build one per fan-out.
+	 */
+	class STORMBYTE_NETWORK_PRIVATE SharedFrame final {
+		public:
+			/**
+			 * @param frame Frame to send (use std::move).
+			 */
+			explicit SharedFrame(Frame&& frame) noexcept;
+
+			/**
+			 * Copy constructor.
+			 */
+			SharedFrame(const SharedFrame& other) = default;
+
+			/**
+			 * Move constructor.
+			 */
+			SharedFrame(SharedFrame&& other) noexcept = default;
+
+			/**
+			 * Destructor.
+			 */
+			~SharedFrame() noexcept = default;
+
+			/**
+			 * Copy assignment.
+			 */
+			SharedFrame& operator=(const SharedFrame& other) = default;
+
+			/**
+			 * Move assignment.
+			 */
+			SharedFrame& operator=(SharedFrame&& other) noexcept = default;
+
+			/**
+			 * Encodes the frame for @p client unless a connection with the same
+			 * encoding was already served.
+			 * @param client Recipient connection.
+			 * @param logger Logger.
+			 * @return On-wire bytes for @p client.
+			 */
+			std::shared_ptr<const Buffer::DataType> For(std::shared_ptr<Connection::Client> client, std::shared_ptr<Logger::Log> logger) noexcept;
+
+			/**
+			 * @return Number of distinct encodings built so far.
+			 */
+			inline std::size_t Encodings() const noexcept {
+				return m_encodings.size();
+			}
+
+		private:
+			/**
+			 * @struct Encoding
+			 * @brief On-wire bytes and the connection they were encoded for.
+			 */
+			struct Encoding {
+				std::shared_ptr<Connection::Client> prototype;	///< Connection the bytes were encoded for
+				std::shared_ptr<const Buffer::DataType> data;	///< Immutable on-wire bytes
+			};
+
+			Frame m_frame;						///< Unencoded frame
+			std::vector<Encoding> m_encodings;	///< Encodings built so far
+	};
+}
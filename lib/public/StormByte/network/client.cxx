@@ -1,7 +1,17 @@
 #include <StormByte/network/connection/client.hxx>
+#include <StormByte/network/connection/handshake.hxx>
 #include <StormByte/network/client.hxx>
+#include <StormByte/network/executor/timer_wheel.hxx>
+#include <StormByte/network/transport/batch.hxx>
+#include <StormByte/network/transport/control_packet.hxx>
 #include <StormByte/network/transport/frame.hxx>
+#include <StormByte/network/transport/heartbeat.hxx>
 #include <StormByte/network/transport/packet.hxx>
+#include <StormByte/network/transport/publication.hxx>
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
 
 using namespace StormByte::Network;
 
@@ -15,18 +25,182 @@ bool Client::Connect(const Connection::Protocol& protocol, const std::string& ad
 		return false;
 	}
 
+	if (!Open(protocol, address, port))
+		return false;
+
+	const Connection::HandshakeOptions handshake = Handshake();
+	if (handshake.enabled && !Negotiate(handshake)) {
+		// Older servers drop the connection on the unknown handshake frame (or ignore it)
+		m_logger << Logger::Level::Warning << "Handshake with " << address << ":" << port
+				<< " failed; reconnecting without optional features" << std::endl;
+		m_connection.reset();
+		if (!Open(protocol, address, port))
+			return false;
+		ApplyCapabilities(m_connection, Connection::Capabilities::Legacy());
+	}
+
+	m_logger << Logger::Level::LowLevel << "Successfully connected to " << address << ":" << port
+			<< " using protocol " << Connection::ProtocolString(protocol) << std::endl;
+	return true;
+}
+
+void Client::Disconnect() noexcept {
+	if (m_connection) {
+		m_logger << Logger::Level::LowLevel << "Disconnecting client." << std::endl;
+		m_connection.reset();
+	}
+	m_batch.reset();
+	m_responses.clear();
+}
+
+Connection::Status Client::Status() const noexcept {
+	return m_connection ? m_connection->Status() : Connection::Status::Disconnected;
+}
+
+Connection::Capabilities Client::Capabilities() const noexcept {
+	return m_connection ? m_connection->Capabilities() : Connection::Capabilities {};
+}
+
+Connection::RoundTripStats Client::RoundTrip() const noexcept {
+	return m_connection ? m_connection->RoundTrip() : Connection::RoundTripStats {};
+}
+
+PacketPointer Client::Send(const Transport::Packet& packet) noexcept {
+	// Posted packets go first so the server sees them in order
+	if (m_batch && !m_batch->Empty() && !SendBatch())
+		return nullptr;
+	if (!Reply(m_connection, packet))
+		return nullptr;
+	Transport::Frame reply = ReceiveReply();
+	if (!m_connection || Refused(reply))
+		return nullptr;
+	return reply.ProcessPacket(m_deserialize_packet_function, m_logger);
+}
+
+bool Client::Post(const Transport::Packet& packet) noexcept {
+	if (!m_connection || !m_connection->Capabilities().Has(Connection::Feature::Batch)) {
+		PacketPointer response = Send(packet);
+		if (!response)
+			return false;
+		m_responses.push_back(response);
+		return true;
+	}
+
+	if (!m_batch)
+		m_batch = std::make_shared<Transport::Batch>();
+
+	if (!m_batch->Add(packet)) {
+		m_logger << Logger::Level::Error << "Packet too large to batch (opcode " << packet.Opcode() << ")" << std::endl;
+		return false;
+	}
+
+	const Transport::BatchOptions options = Batching();
+	if (m_batch->Size() >= options.max_size
+		|| (options.max_packets > 0 && m_batch->Count() >= options.max_packets)
+		|| (options.max_delay > 0 && m_batch->Age() >= std::chrono::milliseconds(options.max_delay)))
+		return SendBatch();
+
+	return true;
+}
+
+std::vector<PacketPointer> Client::Flush() noexcept {
+	if (m_batch && !m_batch->Empty())
+		SendBatch();
+	return std::exchange(m_responses, {});
+}
+
+Transport::BatchOptions Client::Batching() const noexcept {
+	return {};
+}
+
+unsigned int Client::RequestTimeout() const noexcept {
+	return 0;
+}
+
+Connection::DialOptions Client::Dialing() const noexcept {
+	return {};
+}
+
+bool Client::Subscribe(const std::string& topic) noexcept {
+	return RequestSubscription(Transport::Control::Subscribe, topic);
+}
+
+bool Client::Unsubscribe(const std::string& topic) noexcept {
+	return RequestSubscription(Transport::Control::Unsubscribe, topic);
+}
+
+std::size_t Client::Poll(const unsigned int& timeout) noexcept {
+	if (!m_connection)
+		return 0;
+
+	std::size_t handled = 0;
+	// WaitForData treats 0 as "forever"
+	long long wait = std::max<long long>(1, static_cast<long long>(timeout) * 1000);
+	while (true) {
+		auto expected_wait = m_connection->Socket()->WaitForData(wait);
+		if (!expected_wait || expected_wait.value() != Connection::Read::Result::Success)
+			return handled;
+
+		Transport::Frame frame = m_connection->Receive(m_logger);
+		if (AnswerHeartbeat(frame)) {
+			if (!m_connection)
+				return handled;
+		}
+		else if (!frame.IsPublication() || !m_connection->Capabilities().Has(Connection::Feature::PubSub)) {
+			m_logger << Logger::Level::Error << "Unexpected frame with opcode " << frame.Opcode() << " while polling" << std::endl;
+			return handled;
+		}
+		else if (Deliver(frame))
+			++handled;
+		// Only the first wait is long; afterwards take what keeps arriving
+		wait = 1;
+	}
+}
+
+std::optional<std::chrono::microseconds> Client::Ping() noexcept {
+	if (!m_connection || !m_connection->Capabilities().Has(Connection::Feature::Heartbeat)) {
+		m_logger << Logger::Level::Error << "Server does not support heartbeats" << std::endl;
+		return std::nullopt;
+	}
+
+	// Posted packets go first so the server sees them in order
+	if (m_batch && !m_batch->Empty() && !SendBatch())
+		return std::nullopt;
+	if (!Reply(m_connection, Transport::Heartbeat::Ping()))
+		return std::nullopt;
+
+	Transport::Frame pong = ReceiveReply();
+	if (!m_connection)
+		return std::nullopt;
+	if (!Transport::IsControl(pong.Opcode(), Transport::Control::Pong)) {
+		m_logger << Logger::Level::Error << "Expected a heartbeat reply, got opcode " << pong.Opcode() << std::endl;
+		return std::nullopt;
+	}
+
+	auto expected_rtt = Transport::Heartbeat::RoundTrip(pong);
+	if (!expected_rtt) {
+		m_logger << Logger::Level::Error << expected_rtt.error()->what() << std::endl;
+		return std::nullopt;
+	}
+	m_connection->SampleRoundTrip(expected_rtt.value());
+	return expected_rtt.value();
+}
+
+void Client::ProcessPublishedPacket(const std::string& topic, PacketPointer) noexcept {
+	m_logger << Logger::Level::Warning << "Ignoring publication on topic " << topic << std::endl;
+}
+
+bool Client::Open(const Connection::Protocol& protocol, const std::string& address, const unsigned short& port) noexcept {
 	try {
 		std::shared_ptr<Socket::Client> socket = std::make_shared<Socket::Client>(protocol, m_logger);
 
-		if (!socket->Connect(address, port)) {
+		if (!socket->Connect(address, port, Dialing())) {
 			m_logger << Logger::Level::Error << "Failed to connect to " << address << ":" << port
 					<< " using protocol " << Connection::ProtocolString(protocol) << std::endl;
 			return false;
 		}
 
 		m_connection = CreateConnection(socket);
-		m_logger << Logger::Level::LowLevel << "Successfully connected to " << address << ":" << port
-				<< " using protocol " << Connection::ProtocolString(protocol) << std::endl;
 		return true;
 	} catch (const std::bad_alloc& bd) {
 		m_logger << Logger::Level::Error << "Failed to allocate memory for socket: " << bd.what() << std::endl;
@@ -34,17 +208,148 @@ bool Client::Connect(const Connection::Protocol& protocol, const std::string& ad
 	}
 }
 
-void Client::Disconnect() noexcept {
-	if (m_connection) {
-		m_logger << Logger::Level::LowLevel << "Disconnecting client." << std::endl;
-		m_connection.reset();
+bool Client::Negotiate(const Connection::HandshakeOptions& handshake) noexcept {
+	Transport::ControlPacket hello(Transport::Control::Hello, Connection::Handshake::Serialize(LocalCapabilities()));
+	if (!m_connection->Send(Transport::Frame(hello), m_logger))
+		return false;
+
+	auto expected_wait = m_connection->Socket()->WaitForData(static_cast<long long>(handshake.timeout) * 1000000);
+	if (!expected_wait || expected_wait.value() != Connection::Read::Result::Success)
+		return false;
+
+	Transport::Frame frame = m_connection->Receive(m_logger);
+	if (!Transport::IsControl(frame.Opcode(), Transport::Control::HelloAck))
+		return false;
+
+	auto expected_capabilities = Connection::Handshake::Deserialize(frame.Payload());
+	if (!expected_capabilities) {
+		m_logger << Logger::Level::Error << expected_capabilities.error()->what() << std::endl;
+		return false;
 	}
+
+	ApplyCapabilities(m_connection, expected_capabilities.value());
+	return true;
 }
 
-Connection::Status Client::Status() const noexcept {
-	return m_connection ? m_connection->Status() : Connection::Status::Disconnected;
+bool Client::SendBatch() noexcept {
+	const std::size_t count = m_batch->Count();
+	if (!m_connection || !m_connection->Send(m_batch->Release(), m_logger)) {
+		m_logger << Logger::Level::Error << "Failed to send batch of " << count << " packets." << std::endl;
+		return false;
+	}
+
+	Transport::Frame reply = ReceiveReply();
+	if (!m_connection || Refused(reply))
+		return false;
+	if (!reply.IsBatch()) {
+		m_logger << Logger::Level::Error << "Expected a batch reply, got opcode " << reply.Opcode() << std::endl;
+		return false;
+	}
+
+	auto expected_frames = Transport::Batch::Split(reply);
+	if (!expected_frames) {
+		m_logger << Logger::Level::Error << expected_frames.error()->what() << std::endl;
+		return false;
+	}
+
+	for (auto& frame : expected_frames.value()) {
+		PacketPointer response = frame.ProcessPacket(m_deserialize_packet_function, m_logger);
+		if (!response) {
+			m_logger << Logger::Level::Error << "Failed to process batched response." << std::endl;
+			return false;
+		}
+		m_responses.push_back(response);
+	}
+	return true;
 }
 
-PacketPointer Client::Send(const Transport::Packet& packet) noexcept {
-	return Endpoint::Send(m_connection, packet);
+Transport::Frame Client::ReceiveReply() noexcept {
+	const unsigned int timeout = RequestTimeout();
+	// A blocked read only ends when the socket does, so expiry shuts it down
+	const Executor::Deadline deadline(std::chrono::milliseconds(timeout), [socket = m_connection->Socket()] {
+		socket->Interrupt();
+	});
+	while (true) {
+		Transport::Frame frame = m_connection->Receive(m_logger);
+		if (deadline.Expired()) {
+			m_logger << Logger::Level::Error << "No reply within " << timeout << " ms; closing the connection" << std::endl;
+			Disconnect();
+			return frame;
+		}
+		if (AnswerHeartbeat(frame)) {
+			if (!m_connection)
+				return frame;
+			continue;
+		}
+		if (!frame.IsPublication() || !m_connection->Capabilities().Has(Connection::Feature::PubSub))
+			return frame;
+		Deliver(frame);
+	}
+}
+
+bool Client::AnswerHeartbeat(const Transport::Frame& frame) noexcept {
+	if (!Transport::IsControl(frame.Opcode(), Transport::Control::Ping) || !m_connection->Capabilities().Has(Connection::Feature::Heartbeat))
+		return false;
+	if (!Reply(m_connection, Transport::Heartbeat::Pong(frame))) {
+		m_logger << Logger::Level::Error << "Failed to answer heartbeat; closing the connection" << std::endl;
+		Disconnect();
+	}
+	return true;
+}
+
+bool Client::Refused(const Transport::Frame& reply) noexcept {
+	m_busy = Transport::IsControl(reply.Opcode(), Transport::Control::Busy) && m_connection->Capabilities().Has(Connection::Feature::Busy);
+	if (m_busy)
+		m_logger << Logger::Level::Warning << "Server is busy; request was not processed" << std::endl;
+	return m_busy;
+}
+
+bool Client::Deliver(const Transport::Frame& publication) noexcept {
+	auto expected_publication = Transport::Publication::Unwrap(publication);
+	if (!expected_publication) {
+		m_logger << Logger::Level::Error << expected_publication.error()->what() << std::endl;
+		return false;
+	}
+
+	auto& [topic, frame] = expected_publication.value();
+	PacketPointer packet = frame.ProcessPacket(m_deserialize_packet_function, m_logger);
+	if (!packet) {
+		m_logger << Logger::Level::Error << "Failed to process publication on topic " << topic << std::endl;
+		return false;
+	}
+
+	ProcessPublishedPacket(topic, packet);
+	return true;
+}
+
+bool Client::RequestSubscription(const Transport::Control& control, const std::string& topic) noexcept {
+	if (!m_connection || !m_connection->Capabilities().Has(Connection::Feature::PubSub)) {
+		m_logger << Logger::Level::Error << "Server does not support subscriptions" << std::endl;
+		return false;
+	}
+
+	if (topic.size() > Transport::Publication::MAX_TOPIC_SIZE) {
+		m_logger << Logger::Level::Error << "Topic of " << topic.size() << " bytes exceeds the limit" << std::endl;
+		return false;
+	}
+
+	// Posted packets go first so the server sees them in order
+	if (m_batch && !m_batch->Empty() && !SendBatch())
+		return false;
+
+	Buffer::DataType payload;
+	payload.reserve(topic.size());
+	for (const char& c : topic)
+		payload.push_back(static_cast<std::byte>(c));
+	if (!m_connection->Send(Transport::Frame(Transport::ControlPacket(control, std::move(payload))), m_logger))
+		return false;
+
+	Transport::Frame ack = ReceiveReply();
+	if (!m_connection || Refused(ack))
+		return false;
+	if (!Transport::IsControl(ack.Opcode(), control)) {
+		m_logger << Logger::Level::Error << "Expected a subscription acknowledgement, got opcode " << ack.Opcode() << std::endl;
+		return false;
+	}
+	return true;
 }
@@ -19,9 +19,16 @@
 
 #pragma once
 
+#include <StormByte/network/connection/dial.hxx>
+#include <StormByte/network/connection/heartbeat.hxx>
 #include <StormByte/network/endpoint.hxx>
+#include <StormByte/network/transport/batch_options.hxx>
+#include <StormByte/network/transport/control.hxx>
+#include <chrono>
+#include <optional>
 #include <string>
 #include <memory>
+#include <vector>
 
 /**
  * @namespace StormByte::Network
@@ -32,13 +39,21 @@ namespace StormByte::Network {
 		class Client;	///< Forward declaration
 	}
 
+	namespace Transport {
+		class Batch;	///< Forward declaration
+		class Frame;	///< Forward declaration
+	}
+
 	/**
 	 * @class Client
 	 * @brief Abstract application client endpoint.
 	 *
 	 * Derive and implement @ref InputPipeline() / @ref OutputPipeline() (and a
 	 * concrete destructor in a .cxx). Use protected @ref Send() for
-	 * request/response.
+	 * request/response, or @ref Post() / @ref Flush() to send many small
+	 * requests in batch frames. @ref Subscribe() to server topics; their
+	 * publications are handed to @ref ProcessPublishedPacket() whenever the
+	 * client reads (during a request or @ref Poll()).
 	 *
 	 * @note **Inheritance-oriented.** Not for direct “generic” use without a subclass.
 	 */
@@ -50,7 +65,9 @@ namespace StormByte::Network {
 			 */
 			inline Client(const DeserializePacketFunction& deserialize_packet_function, std::shared_ptr<Logger::Log> logger) noexcept:
 				Endpoint(deserialize_packet_function, logger),
-				m_connection(nullptr) {}
+				m_connection(nullptr),
+				m_batch(nullptr),
+				m_busy(false) {}
 
 			/**
 			 * Copy constructor (deleted).
@@ -96,15 +113,177 @@ namespace StormByte::Network {
 			 */
 			Connection::Status Status() const noexcept override;
 
+			/**
+			 * @return Capabilities negotiated with the server (legacy if it
+			 * did not answer the handshake or no handshake was made).
+			 */
+			Connection::Capabilities Capabilities() const noexcept;
+
+			/**
+			 * @return Round-trip times measured by @ref Ping() (no samples
+			 * while disconnected).
+			 */
+			Connection::RoundTripStats RoundTrip() const noexcept;
+
 		protected:
 			/**
 			 * Sends @p packet and returns the response packet (or nullptr).
 			 * @param packet Request packet.
-			 * @return Response, or nullptr on error.
+			 * @return Response, or nullptr on error (see @ref ServerBusy()).
 			 */
 			PacketPointer Send(const Transport::Packet& packet) noexcept;
 
+			/**
+			 * @return true if the last request or batch was refused because
+			 * the server was overloaded (Transport::Control::Busy); it was not
+			 * processed and may be retried later.
+			 */
+			inline bool ServerBusy() const noexcept {
+				return m_busy;
+			}
+
+			/**
+			 * Queues @p packet in the current batch, sending the batch once a
+			 * @ref Batching() threshold is reached. Servers without batch
+			 * support get a plain request instead. Packets keep their order,
+			 * also relative to @ref Send().
+			 * @param packet Request packet.
+			 * @return false if the packet could not be queued or a batch failed.
+			 */
+			bool Post(const Transport::Packet& packet) noexcept;
+
+			/**
+			 * Sends the pending batch (if any).
+			 * @return Responses to every packet posted since the last flush, in
+			 * order (fewer if a batch failed; the failure is logged).
+			 */
+			std::vector<PacketPointer> Flush() noexcept;
+
+			/**
+			 * @return Thresholds for @ref Post() (default: BatchOptions defaults).
+			 */
+			virtual Transport::BatchOptions Batching() const noexcept;
+
+			/**
+			 * @return Milliseconds to wait for each reply or acknowledgement
+			 * (default: 0, wait forever). On expiry the request fails and the
+			 * connection is closed, since a late reply could not be told apart
+			 * from the next one.
+			 */
+			virtual unsigned int RequestTimeout() const noexcept;
+
+			/**
+			 * @return Connect deadline and the stagger between attempts at the
+			 * host's addresses (default: DialOptions defaults). Connect with
+			 * Connection::Protocol::Any to race both IPv6 and IPv4.
+			 */
+			virtual Connection::DialOptions Dialing() const noexcept;
+
+			/**
+			 * Subscribes to @p topic (requires Connection::Feature::PubSub).
+			 * @param topic Topic name.
+			 * @return true once the server acknowledged it.
+			 */
+			bool Subscribe(const std::string& topic) noexcept;
+
+			/**
+			 * Unsubscribes from @p topic.
+			 * @param topic Topic name.
+			 * @return true once the server acknowledged it.
+			 */
+			bool Unsubscribe(const std::string& topic) noexcept;
+
+			/**
+			 * Waits up to @p timeout milliseconds for a publication, then handles
+			 * publications for as long as they keep arriving. Server heartbeats
+			 * are answered meanwhile, so idle clients should poll more often
+			 * than the server's Connection::HeartbeatOptions allow silence.
+			 * @param timeout Maximum wait in milliseconds.
+			 * @return Number of publications handled.
+			 */
+			std::size_t Poll(const unsigned int& timeout) noexcept;
+
+			/**
+			 * Measures the round trip to the server with a heartbeat frame
+			 * (requires Connection::Feature::Heartbeat), also added to
+			 * @ref RoundTrip(). Unlike a socket-level check, it fails on peers
+			 * that vanished without closing the connection (within
+			 * @ref RequestTimeout()).
+			 * @return Round-trip time, or std::nullopt on failure.
+			 */
+			std::optional<std::chrono::microseconds> Ping() noexcept;
+
+			/**
+			 * Publication handler.
+			 * @param topic Topic the packet was published to.
+			 * @param packet Published packet.
+			 */
+			virtual void ProcessPublishedPacket(const std::string& topic, PacketPointer packet) noexcept;
+
 		private:
 			std::shared_ptr<Connection::Client> m_connection;	///< Active connection
+			std::shared_ptr<Transport::Batch> m_batch;			///< Packets posted but not sent yet
+			std::vector<PacketPointer> m_responses;				///< Responses not returned by Flush() yet
+			bool m_busy;										///< Last request was refused as Busy
+
+			/**
+			 * Opens the socket and wraps it in @ref m_connection.
+			 * @param protocol Address family.
+			 * @param address Hostname or IP.
+			 * @param port Port number.
+			 * @return true on success.
+			 */
+			bool Open(const Connection::Protocol& protocol, const std::string& address, const unsigned short& port) noexcept;
+
+			/**
+			 * Sends the handshake and applies the server's answer.
+			 * @param handshake Handshake options.
+			 * @return false if the server did not answer in time (or answered badly).
+			 */
+			bool Negotiate(const Connection::HandshakeOptions& handshake) noexcept;
+
+			/**
+			 * Sends the pending batch and stores its responses.
+			 * @return false on send failure or malformed reply.
+			 */
+			bool SendBatch() noexcept;
+
+			/**
+			 * Receives the next frame that is not a publication, handling
+			 * publications received before it.
+			 * @return Reply frame (empty on failure; disconnected once
+			 * @ref RequestTimeout() expired).
+			 */
+			Transport::Frame ReceiveReply() noexcept;
+
+			/**
+			 * Echoes @p frame if it is a server heartbeat (disconnecting if
+			 * the echo cannot be sent).
+			 * @param frame Received frame.
+			 * @return true if @p frame was a heartbeat.
+			 */
+			bool AnswerHeartbeat(const Transport::Frame& frame) noexcept;
+
+			/**
+			 * Records whether @p reply is a Busy frame.
+			 * @param reply Reply frame.
+			 * @return true if the server refused the request.
+			 */
+			bool Refused(const Transport::Frame& reply) noexcept;
+
+			/**
+			 * Unpacks a publication and calls @ref ProcessPublishedPacket().
+			 * @param publication Received @ref Transport::Control::Publish frame.
+			 * @return false if the publication is malformed.
+			 */
+			bool Deliver(const Transport::Frame& publication) noexcept;
+
+			/**
+			 * Sends a subscription request and waits for its acknowledgement.
+			 * @param control Subscribe or Unsubscribe.
+			 * @param topic Topic name.
+			 * @return true once acknowledged.
+			 */
+			bool RequestSubscription(const Transport::Control& control, const std::string& topic) noexcept;
 	};
 }
@@ -0,0 +1,253 @@
+#include <StormByte/network/client_pool.hxx>
+
+#include <algorithm>
+#include <utility>
+
+using namespace StormByte::Network;
+
+namespace {
+	/**
+	 * @param protocol Address family.
+	 * @param address Hostname or IP.
+	 * @param port Port number.
+	 * @return Host key.
+	 */
+	std::string Key(const Connection::Protocol& protocol, const std::string& address, const unsigned short& port) {
+		return std::to_string(Connection::ProtocolInt(protocol)) + "/" + address + ":" + std::to_string(port);
+	}
+}
+
+ClientPool::Lease::Lease(ClientPool* pool, Host* host, std::unique_ptr<Client> client) noexcept:
+	m_pool(pool),
+	m_host(host),
+	m_client(std::move(client)) {}
+
+ClientPool::Lease::Lease(Lease&& other) noexcept:
+	m_pool(std::exchange(other.m_pool, nullptr)),
+	m_host(std::exchange(other.m_host, nullptr)),
+	m_client(std::move(other.m_client)) {}
+
+ClientPool::Lease::~Lease() noexcept {
+	Return();
+}
+
+ClientPool::Lease& ClientPool::Lease::operator=(Lease&& other) noexcept {
+	if (this != &other) {
+		Return();
+		m_pool = std::exchange(other.m_pool, nullptr);
+		m_host = std::exchange(other.m_host, nullptr);
+		m_client = std::move(other.m_client);
+	}
+	return *this;
+}
+
+void ClientPool::Lease::Discard() noexcept {
+	if (m_client)
+		m_client->Disconnect();
+	Return();
+}
+
+void ClientPool::Lease::Return() noexcept {
+	if (m_client)
+		m_pool->Return(*m_host, std::move(m_client));
+	m_pool = nullptr;
+	m_host = nullptr;
+}
+
+ClientPool::ClientPool(Factory factory, const Connection::PoolOptions& options, std::shared_ptr<Logger::Log> logger) noexcept:
+	m_factory(std::move(factory)),
+	m_options(options),
+	m_logger(logger),
+	m_closed(false) {
+	m_options.max_connections = std::max(m_options.max_connections, 1u);
+	m_options.min_connections = std::min(m_options.min_connections, m_options.max_connections);
+}
+
+ClientPool::~ClientPool() noexcept {
+	Close();
+}
+
+std::size_t ClientPool::Warm(const Connection::Protocol& protocol, const std::string& address, const unsigned short& port) noexcept {
+	std::unique_lock lock(m_mutex);
+	Host& host = Find(protocol, address, port);
+	while (!m_closed && host.open < m_options.min_connections) {
+		++host.open;
+		lock.unlock();
+		std::unique_ptr<Client> client = Open(host);
+		lock.lock();
+
+		if (!client) {
+			--host.open;
+			host.returned.notify_one();
+			break;
+		}
+		++host.stats.created;
+		host.idle.push_back({ std::move(client), std::chrono::steady_clock::now() });
+		host.returned.notify_one();
+	}
+	return host.open;
+}
+
+ClientPool::Lease ClientPool::Acquire(const Connection::Protocol& protocol, const std::string& address, const unsigned short& port) noexcept {
+	const auto start = std::chrono::steady_clock::now();
+	const auto deadline = start + std::chrono::milliseconds(m_options.acquire_timeout);
+	Closing closing;	// Destroyed after the lock is released
+	std::unique_lock lock(m_mutex);
+	Host& host = Find(protocol, address, port);
+	bool waited = false;
+
+	while (!m_closed) {
+		Expire(host, closing);
+
+		// The most recently returned client is the likeliest to still be up
+		while (!host.idle.empty()) {
+			std::unique_ptr<Client> client = std::move(host.idle.back().client);
+			host.idle.pop_back();
+			if (client->Status() == Connection::Status::Connected) {
+				Record(host, start, true);
+				return Lease(this, &host, std::move(client));
+			}
+			--host.open;
+			++host.stats.evicted;
+			closing.push_back(std::move(client));
+		}
+
+		if (host.open < m_options.max_connections) {
+			++host.open;
+			lock.unlock();
+			std::unique_ptr<Client> client = Open(host);
+			lock.lock();
+
+			if (!client) {
+				--host.open;
+				host.returned.notify_one();
+				Record(host, start, false);
+				return {};
+			}
+			++host.stats.created;
+			Record(host, start, true);
+			return Lease(this, &host, std::move(client));
+		}
+
+		if (!waited) {
+			waited = true;
+			++host.stats.waited;
+		}
+		if (m_options.acquire_timeout == 0)
+			host.returned.wait(lock);
+		else if (host.returned.wait_until(lock, deadline) == std::cv_status::timeout) {
+			m_logger << Logger::Level::Warning << "Timed out waiting for a connection to " << host.address
+					<< ":" << host.port << std::endl;
+			Record(host, start, false);
+			return {};
+		}
+	}
+
+	Record(host, start, false);
+	return {};
+}
+
+Connection::PoolStats ClientPool::Stats() const noexcept {
+	std::scoped_lock lock(m_mutex);
+	Connection::PoolStats total;
+	for (const auto& [key, host]: m_hosts) {
+		const Connection::PoolStats& stats = host->stats;
+		total.idle += host->idle.size();
+		total.in_use += stats.in_use;
+		total.created += stats.created;
+		total.evicted += stats.evicted;
+		total.acquired += stats.acquired;
+		total.waited += stats.waited;
+		total.failed += stats.failed;
+		total.wait_total += stats.wait_total;
+		total.wait_max = std::max(total.wait_max, stats.wait_max);
+	}
+	return total;
+}
+
+Connection::PoolStats ClientPool::Stats(const Connection::Protocol& protocol, const std::string& address, const unsigned short& port) const noexcept {
+	std::scoped_lock lock(m_mutex);
+	auto it = m_hosts.find(Key(protocol, address, port));
+	if (it == m_hosts.end())
+		return {};
+
+	Connection::PoolStats stats = it->second->stats;
+	stats.idle = it->second->idle.size();
+	return stats;
+}
+
+void ClientPool::Close() noexcept {
+	Closing closing;
+	std::scoped_lock lock(m_mutex);
+	m_closed = true;
+	for (auto& [key, host]: m_hosts) {
+		for (Idle& idle: host->idle)
+			closing.push_back(std::move(idle.client));
+		host->open -= host->idle.size();
+		host->stats.evicted += host->idle.size();
+		host->idle.clear();
+		host->returned.notify_all();
+	}
+}
+
+ClientPool::Host& ClientPool::Find(const Connection::Protocol& protocol, const std::string& address, const unsigned short& port) noexcept {
+	std::unique_ptr<Host>& host = m_hosts[Key(protocol, address, port)];
+	if (!host) {
+		host = std::make_unique<Host>();
+		host->protocol = protocol;
+		host->address = address;
+		host->port = port;
+	}
+	return *host;
+}
+
+std::unique_ptr<Client> ClientPool::Open(const Host& host) noexcept {
+	std::unique_ptr<Client> client = m_factory ? m_factory() : nullptr;
+	if (!client || !client->Connect(host.protocol, host.address, host.port)) {
+		m_logger << Logger::Level::Error << "Pool failed to connect to " << host.address << ":" << host.port << std::endl;
+		return nullptr;
+	}
+	return client;
+}
+
+void ClientPool::Expire(Host& host, Closing& closing) noexcept {
+	if (m_options.idle_timeout == 0)
+		return;
+
+	const auto oldest = std::chrono::steady_clock::now() - std::chrono::milliseconds(m_options.idle_timeout);
+	std::size_t expired = 0;
+	while (expired < host.idle.size() && host.open - expired > m_options.min_connections && host.idle[expired].since < oldest)
+		++expired;
+
+	for (std::size_t i = 0; i < expired; ++i)
+		closing.push_back(std::move(host.idle[i].client));
+	host.idle.erase(host.idle.begin(), host.idle.begin() + expired);
+	host.open -= expired;
+	host.stats.evicted += expired;
+}
+
+void ClientPool::Record(Host& host, const std::chrono::steady_clock::time_point& start, bool success) noexcept {
+	const auto wait = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+	host.stats.wait_total += wait;
+	host.stats.wait_max = std::max(host.stats.wait_max, wait);
+	if (success) {
+		++host.stats.acquired;
+		++host.stats.in_use;
+	}
+	else
+		++host.stats.failed;
+}
+
+void ClientPool::Return(Host& host, std::unique_ptr<Client> client) noexcept {
+	Closing closing;
+	std::scoped_lock lock(m_mutex);
+	--host.stats.in_use;
+	if (!m_closed && client->Status() == Connection::Status::Connected)
+		host.idle.push_back({ std::move(client), std::chrono::steady_clock::now() });
+	else {
+		--host.open;
+		++host.stats.evicted;
+		closing.push_back(std::move(client));
+	}
+	host.returned.notify_one();
+}
@@ -0,0 +1,293 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <StormByte/network/client.hxx>
+#include <StormByte/network/connection/pool.hxx>
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @namespace StormByte::Network
+ * @brief StormByte networking subsystem.
+ */
+namespace StormByte::Network {
+	/**
+	 * @class ClientPool
+	 * @brief Warm client connections per host, leased one request (or
+	 * sequence of requests) at a time.
+	 *
+	 * Each host (protocol, address, port) keeps between
+	 * Connection::PoolOptions::min_connections and max_connections open
+	 * clients built by the factory. @ref Acquire() hands out an idle one, opens
+	 * a new one below the limit, or waits for one to be returned. Broken
+	 * connections are evicted when acquired or returned, and idle ones above
+	 * the minimum after Connection::PoolOptions::idle_timeout.
+	 *
+	 * Thread-safe. Every Lease must be gone before the pool is destroyed.
+	 */
+	class STORMBYTE_NETWORK_PUBLIC ClientPool final {
+		private:
+			struct Host;
+
+		public:
+			using Factory = std::function<std::unique_ptr<Client>()>;	///< Builds an unconnected client
+
+			/**
+			 * @class Lease
+			 * @brief Exclusive use of a pooled client; returns it on destruction.
+			 */
+			class STORMBYTE_NETWORK_PUBLIC Lease final {
+				public:
+					/**
+					 * Empty lease (no client).
+					 */
+					Lease() noexcept = default;
+
+					/**
+					 * Copy constructor (deleted).
+					 */
+					Lease(const Lease& other) = delete;
+
+					/**
+					 * Move constructor.
+					 */
+					Lease(Lease&& other) noexcept;
+
+					/**
+					 * Destructor (returns the client to its pool).
+					 */
+					~Lease() noexcept;
+
+					/**
+					 * Copy assignment (deleted).
+					 */
+					Lease& operator=(const Lease& other) = delete;
+
+					/**
+					 * Move assignment (returns the current client first).
+					 */
+					Lease& operator=(Lease&& other) noexcept;
+
+					/**
+					 * @return true if a client was leased.
+					 */
+					inline explicit operator bool() const noexcept {
+						return static_cast<bool>(m_client);
+					}
+
+					/**
+					 * @return Leased client.
+					 */
+					inline Client* operator->() const noexcept {
+						return m_client.get();
+					}
+
+					/**
+					 * @return Leased client.
+					 */
+					inline Client& operator*() const noexcept {
+						return *m_client;
+					}
+
+					/**
+					 * @tparam T Type the pool's factory builds.
+					 * @return Leased client as @p T.
+					 */
+					template <typename T>
+					inline T& As() const noexcept {
+						return static_cast<T&>(*m_client);
+					}
+
+					/**
+					 * Closes the client instead of returning it (e.g. after a
+					 * protocol error the connection cannot recover from).
+					 */
+					void Discard() noexcept;
+
+				private:
+					friend class ClientPool;
+
+					ClientPool* m_pool = nullptr;			///< Owning pool
+					Host* m_host = nullptr;					///< Host the client belongs to
+					std::unique_ptr<Client> m_client;		///< Leased client
+
+					/**
+					 * @param pool Owning pool.
+					 * @param host Host the client belongs to.
+					 * @param client Leased client.
+					 */
+					Lease(ClientPool* pool, Host* host, std::unique_ptr<Client> client) noexcept;
+
+					/**
+					 * Hands the client back to the pool.
+					 */
+					void Return() noexcept;
+			};
+
+			/**
+			 * @param factory Builds the pool's clients.
+			 * @param options Per-host limits.
+			 * @param logger Diagnostic logger.
+			 */
+			ClientPool(Factory factory, const Connection::PoolOptions& options, std::shared_ptr<Logger::Log> logger) noexcept;
+
+			/**
+			 * Copy constructor (deleted).
+			 */
+			ClientPool(const ClientPool& other) = delete;
+
+			/**
+			 * Move constructor (deleted).
+			 */
+			ClientPool(ClientPool&& other) noexcept = delete;
+
+			/**
+			 * Destructor (closes idle connections).
+			 */
+			~ClientPool() noexcept;
+
+			/**
+			 * Copy assignment (deleted).
+			 */
+			ClientPool& operator=(const ClientPool& other) = delete;
+
+			/**
+			 * Move assignment (deleted).
+			 */
+			ClientPool& operator=(ClientPool&& other) noexcept = delete;
+
+			/**
+			 * Opens connections to a host up to its minimum, e.g. at startup.
+			 * @param protocol Address family.
+			 * @param address Hostname or IP.
+			 * @param port Port number.
+			 * @return Open connections to the host afterwards.
+			 */
+			std::size_t Warm(const Connection::Protocol& protocol, const std::string& address, const unsigned short& port) noexcept;
+
+			/**
+			 * Leases a connected client to a host, waiting up to
+			 * Connection::PoolOptions::acquire_timeout at the host's limit.
+			 * @param protocol Address family.
+			 * @param address Hostname or IP.
+			 * @param port Port number.
+			 * @return Lease, empty on timeout or connect failure.
+			 */
+			Lease Acquire(const Connection::Protocol& protocol, const std::string& address, const unsigned short& port) noexcept;
+
+			/**
+			 * @return Counters summed over every host.
+			 */
+			Connection::PoolStats Stats() const noexcept;
+
+			/**
+			 * @param protocol Address family.
+			 * @param address Hostname or IP.
+			 * @param port Port number.
+			 * @return Counters of one host (zero if never used).
+			 */
+			Connection::PoolStats Stats(const Connection::Protocol& protocol, const std::string& address, const unsigned short& port) const noexcept;
+
+			/**
+			 * Closes every idle connection; leased ones are closed when returned.
+			 */
+			void Close() noexcept;
+
+		private:
+			/**
+			 * @struct Idle
+			 * @brief Connected client waiting in a host's pool.
+			 */
+			struct Idle {
+				std::unique_ptr<Client> client;					///< Client
+				std::chrono::steady_clock::time_point since;	///< Returned at
+			};
+
+			/**
+			 * @struct Host
+			 * @brief Connections to one host.
+			 */
+			struct Host {
+				Connection::Protocol protocol;		///< Address family
+				std::string address;				///< Hostname or IP
+				unsigned short port;				///< Port
+				std::vector<Idle> idle;				///< Idle clients, oldest first
+				std::size_t open = 0;				///< Idle, leased and connecting clients
+				std::condition_variable returned;	///< Signals a returned or closed client
+				Connection::PoolStats stats;		///< Counters (idle / in_use filled on read)
+			};
+
+			using Closing = std::vector<std::unique_ptr<Client>>;	///< Clients to close outside the lock
+
+			Factory m_factory;										///< Client factory
+			Connection::PoolOptions m_options;						///< Per-host limits
+			std::shared_ptr<Logger::Log> m_logger;					///< Logger
+			std::unordered_map<std::string, std::unique_ptr<Host>> m_hosts;	///< Hosts by protocol, address and port
+			mutable std::mutex m_mutex;								///< Protects m_hosts, their contents and m_closed
+			bool m_closed;											///< Close() was called
+
+			/**
+			 * Finds or adds a host. Requires m_mutex.
+			 * @param protocol Address family.
+			 * @param address Hostname or IP.
+			 * @param port Port number.
+			 * @return Host.
+			 */
+			Host& Find(const Connection::Protocol& protocol, const std::string& address, const unsigned short& port) noexcept;
+
+			/**
+			 * Builds and connects a client (without holding m_mutex).
+			 * @param host Host to connect to.
+			 * @return Connected client or nullptr.
+			 */
+			std::unique_ptr<Client> Open(const Host& host) noexcept;
+
+			/**
+			 * Moves idle clients above the minimum that outstayed the idle
+			 * timeout to @p closing. Requires m_mutex.
+			 * @param host Host.
+			 * @param closing Receives the clients to close.
+			 */
+			void Expire(Host& host, Closing& closing) noexcept;
+
+			/**
+			 * Accounts for an acquisition that started at @p start. Requires m_mutex.
+			 * @param host Host.
+			 * @param start Acquisition start.
+			 * @param success true if a client was leased.
+			 */
+			static void Record(Host& host, const std::chrono::steady_clock::time_point& start, bool success) noexcept;
+
+			/**
+			 * Takes a client back from a lease.
+			 * @param host Host the client belongs to.
+			 * @param client Client.
+			 */
+			void Return(Host& host, std::unique_ptr<Client> client) noexcept;
+	};
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <StormByte/network/visibility.h>
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @namespace Connection
+ * @brief Connection-level types (protocol, status, read/write results).
+ */
+namespace StormByte::Network::Connection {
+	/**
+	 * @struct AdmissionOptions
+	 * @brief Global server limits, enforced before work is started.
+	 *
+	 * Connections over @ref max_connections are closed right after accept.
+	 * Requests over @ref max_requests or @ref max_buffered_bytes are not
+	 * handed to the application: the client gets a Transport::Control::Busy
+	 * reply instead (see Feature::Busy). Zero disables a limit.
+	 */
+	struct STORMBYTE_NETWORK_PUBLIC AdmissionOptions {
+		std::size_t max_connections = 0;	///< Connected clients
+		std::size_t max_requests = 0;		///< Requests (or batches) being processed at once
+		std::size_t max_buffered_bytes = 0;	///< Payload bytes of requests being processed plus queued outbound bytes
+	};
+
+	/**
+	 * @struct AdmissionStats
+	 * @brief Current server load and shedding counters.
+	 */
+	struct STORMBYTE_NETWORK_PUBLIC AdmissionStats {
+		std::size_t connections = 0;			///< Connected clients
+		std::size_t requests = 0;				///< Requests being processed
+		std::size_t buffered_bytes = 0;			///< Request payload plus queued outbound bytes
+		std::uint64_t rejected_connections = 0;	///< Connections closed at accept
+		std::uint64_t shed_requests = 0;		///< Requests answered with Busy
+	};
+}
@@ -0,0 +1,25 @@
+#include <StormByte/network/connection/capabilities.hxx>
+
+#include <algorithm>
+
+using namespace StormByte::Network::Connection;
+
+Capabilities Capabilities::Intersect(const Capabilities& peer) const noexcept {
+	Capabilities result;
+	result.version = std::min(version, peer.version);
+	result.features = features & peer.features;
+	result.max_frame_size = peer.max_frame_size;
+	result.compression = compression & peer.compression;
+	for (const auto& [opcode, id] : dictionaries) {
+		auto it = peer.dictionaries.find(opcode);
+		if (it != peer.dictionaries.end() && it->second == id)
+			result.dictionaries.emplace(opcode, id);
+	}
+	return result;
+}
+
+Capabilities Capabilities::Legacy() noexcept {
+	Capabilities result;
+	result.version = 0;
+	return result;
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <StormByte/network/transport/packet.hxx>
+#include <StormByte/network/visibility.h>
+
+#include <cstdint>
+#include <unordered_map>
+
+/**
+ * @namespace Connection
+ * @brief Connection-level types (protocol, status, read/write results).
+ */
+namespace StormByte::Network::Connection {
+	/**
+	 * @enum Feature
+	 * @brief Optional protocol features advertised during the handshake.
+	 *
+	 * There is no request ID feature: replies on a connection come back in
+	 * request order, so frames carry no correlation ID to negotiate. Unknown
+	 * bits are ignored by older peers, so one can be added later.
+	 */
+	enum class STORMBYTE_NETWORK_PUBLIC Feature: std::uint32_t {
+		None		= 0,		///< No optional features
+		FrameFlags	= 1 << 0,	///< Frame header flag byte (chunked frames)
+		Compression	= 1 << 1,	///< Compressed frames
+		Checksum	= 1 << 2,	///< CRC32C frame trailers are verified
+		Batch		= 1 << 3,	///< Batch frames are unpacked
+		PubSub		= 1 << 4,	///< Topic subscriptions and published frames
+		Busy		= 1 << 5,	///< Busy replies to shed requests are understood
+		Heartbeat	= 1 << 6,	///< Ping frames are answered with Pong
+	};
+
+	/**
+	 * @struct HandshakeOptions
+	 * @brief Endpoint handshake settings.
+	 *
+	 * When enabled, a client sends its capabilities right after connecting
+	 * and waits up to @ref timeout seconds for the server's; if the peer does
+	 * not answer (older library) it reconnects without optional features. A
+	 * server with the handshake enabled treats clients whose first frame is
+	 * not a handshake the same way.
+	 */
+	struct STORMBYTE_NETWORK_PUBLIC HandshakeOptions {
+		bool enabled = false;				///< Perform the handshake
+		unsigned short timeout = 5;			///< Seconds to wait for the peer's answer (0 = forever)
+		std::size_t max_frame_size = 0;		///< Largest inbound frame payload accepted (0 = unlimited)
+	};
+
+	/**
+	 * @struct Capabilities
+	 * @brief Protocol version and features of one side of a connection.
+	 */
+	struct STORMBYTE_NETWORK_PUBLIC Capabilities {
+		static constexpr std::uint16_t PROTOCOL_VERSION = 1;							///< Current protocol version
+
+		std::uint16_t version = PROTOCOL_VERSION;										///< Protocol version (0 = legacy peer)
+		std::uint32_t features = 0;														///< @ref Feature bits
+		std::size_t max_frame_size = 0;													///< Largest frame payload accepted (0 = unlimited)
+		std::uint8_t compression = 0;													///< Decodable algorithms (bit = 1 << Compression::Algorithm)
+		std::unordered_map<Transport::Packet::OpcodeType, std::uint32_t> dictionaries;	///< Opcode -> dictionary ID
+
+		/**
+		 * @param feature Feature to test.
+		 * @return true if @p feature is set.
+		 */
+		inline bool Has(const Feature& feature) const noexcept {
+			return (features & static_cast<std::uint32_t>(feature)) != 0;
+		}
+
+		/**
+		 * Combines local and peer capabilities into what may be used when
+		 * sending to the peer.
+		 * @param peer Peer capabilities.
+		 * @return Common version and features, peer limits, matching dictionaries.
+		 */
+		Capabilities Intersect(const Capabilities& peer) const noexcept;
+
+		/**
+		 * @return Capabilities of a peer without handshake support.
+		 */
+		static Capabilities Legacy() noexcept;
+	};
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <StormByte/network/visibility.h>
+
+/**
+ * @namespace Connection
+ * @brief Connection-level types (protocol, status, read/write results).
+ */
+namespace StormByte::Network::Connection {
+	/**
+	 * @struct DialOptions
+	 * @brief How a client connects to a host with several addresses.
+	 *
+	 * Every resolved address is tried, alternating IPv6 and IPv4 (RFC 8305,
+	 * "Happy Eyeballs"): a new attempt starts every @ref attempt_delay, or
+	 * as soon as the previous one fails, while earlier attempts keep going.
+	 * The first to complete wins and the rest are dropped.
+	 */
+	struct STORMBYTE_NETWORK_PUBLIC DialOptions {
+		unsigned int timeout = 10000;		///< Milliseconds for the whole connect (0 = system limit)
+		unsigned int attempt_delay = 250;	///< Milliseconds before racing the next address
+	};
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <StormByte/network/transport/packet.hxx>
+#include <StormByte/network/visibility.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @namespace Connection
+ * @brief Connection-level types (protocol, status, read/write results).
+ */
+namespace StormByte::Network::Connection {
+	/**
+	 * @struct HandlerClass
+	 * @brief A class of requests (e.g. interactive, bulk) with its own
+	 * handler threads and queue.
+	 *
+	 * Threads take the next request from the highest-priority non-empty
+	 * queue among their own class and the classes above it, so spare bulk
+	 * capacity helps interactive requests but never the other way round.
+	 */
+	struct STORMBYTE_NETWORK_PUBLIC HandlerClass {
+		std::string name;			///< Label for logs
+		std::size_t threads = 1;	///< Handler threads (at least 1)
+		int priority = 0;			///< Higher is served first
+		bool ordered = false;		///< Requests of one connection in this class run one at a time, in arrival order
+	};
+
+	/**
+	 * @struct DispatchOptions
+	 * @brief Routes decoded requests by opcode to handler classes.
+	 *
+	 * Unrouted opcodes (and batches) are handled on the connection's own
+	 * thread (or its stage lane, see StagingOptions), in order, as without
+	 * dispatching. Routed ones are queued and
+	 * the connection keeps reading, so a slow request does not hold up the
+	 * next one; replies of unordered classes may then overtake each other.
+	 */
+	struct STORMBYTE_NETWORK_PUBLIC DispatchOptions {
+		std::vector<HandlerClass> classes;										///< Handler classes
+		std::unordered_map<Transport::Packet::OpcodeType, std::size_t> routes;	///< Opcode to index in @ref classes
+	};
+}
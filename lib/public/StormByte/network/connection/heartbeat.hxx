@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <StormByte/network/visibility.h>
+
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @namespace Connection
+ * @brief Connection-level types (protocol, status, read/write results).
+ */
+namespace StormByte::Network::Connection {
+	/**
+	 * @struct HeartbeatOptions
+	 * @brief Server heartbeats to every client.
+	 *
+	 * Every @ref interval the server sends a Transport::Control::Ping frame
+	 * and the client echoes it whenever it reads (during a request or
+	 * Client::Poll()). Any frame counts as a sign of life; a client silent
+	 * for @ref max_missed intervals is disconnected as unresponsive, which
+	 * also catches half-open connections the socket never reports.
+	 */
+	struct STORMBYTE_NETWORK_PUBLIC HeartbeatOptions {
+		unsigned int interval = 0;		///< Milliseconds between heartbeats (0 = off)
+		unsigned int max_missed = 3;	///< Intervals without any frame before the client is disconnected (0 = never)
+	};
+
+	/**
+	 * @struct RoundTripStats
+	 * @brief Heartbeat round-trip times of one connection.
+	 */
+	struct STORMBYTE_NETWORK_PUBLIC RoundTripStats {
+		std::chrono::microseconds last {};		///< Latest sample
+		std::chrono::microseconds smoothed {};	///< Moving average (1/8 weight per sample, as TCP's SRTT)
+		std::chrono::microseconds min {};		///< Smallest sample
+		std::uint64_t samples = 0;				///< Number of samples (0 = none yet)
+	};
+}
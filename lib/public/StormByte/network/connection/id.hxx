@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <StormByte/network/visibility.h>
+
+#include <compare>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string>
+
+/**
+ * @namespace Connection
+ * @brief Connection-level types (protocol, status, read/write results).
+ */
+namespace StormByte::Network::Connection {
+	/**
+	 * @class ID
+	 * @brief Server-side connection identifier: registry slot + generation.
+	 *
+	 * Slots are reused once a client disconnects; the generation changes on
+	 * every reuse, so a stale ID never matches the slot's new connection.
+	 * Cheap to copy, compare and hash.
+	 */
+	class STORMBYTE_NETWORK_PUBLIC ID {
+		public:
+			static constexpr std::uint32_t INVALID_INDEX = std::numeric_limits<std::uint32_t>::max();	///< Index of an invalid ID
+
+			/**
+			 * Invalid ID.
+			 */
+			constexpr ID() noexcept = default;
+
+			/**
+			 * @param index Registry slot.
+			 * @param generation Slot generation.
+			 */
+			constexpr ID(const std::uint32_t& index, const std::uint32_t& generation) noexcept:
+			m_index(index),
+			m_generation(generation) {}
+
+			/**
+			 * @return Registry slot.
+			 */
+			constexpr const std::uint32_t& Index() const noexcept {
+				return m_index;
+			}
+
+			/**
+			 * @return Slot generation.
+			 */
+			constexpr const std::uint32_t& Generation() const noexcept {
+				return m_generation;
+			}
+
+			/**
+			 * @return true unless default-constructed.
+			 */
+			constexpr bool Valid() const noexcept {
+				return m_index != INVALID_INDEX;
+			}
+
+			/**
+			 * @return Index and generation packed in 64 bits.
+			 */
+			constexpr std::uint64_t Value() const noexcept {
+				return (static_cast<std::uint64_t>(m_generation) << 32) | m_index;
+			}
+
+			/**
+			 * @return "index:generation" for logs.
+			 */
+			inline std::string ToString() const {
+				return std::to_string(m_index) + ":" + std::to_string(m_generation);
+			}
+
+			/**
+			 * Equality / ordering by index then generation.
+			 */
+			constexpr auto operator<=>(const ID& other) const noexcept = default;
+
+		private:
+			std::uint32_t m_index = INVALID_INDEX;	///< Registry slot
+			std::uint32_t m_generation = 0;			///< Slot generation
+	};
+}
+
+/**
+ * @brief Hash support so IDs can key unordered containers.
+ */
+template <>
+struct std::hash<StormByte::Network::Connection::ID> {
+	std::size_t operator()(const StormByte::Network::Connection::ID& id) const noexcept {
+		return std::hash<std::uint64_t>{}(id.Value());
+	}
+};
@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <StormByte/network/visibility.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @namespace Connection
+ * @brief Connection-level types (protocol, status, read/write results).
+ */
+namespace StormByte::Network::Connection {
+	/**
+	 * @struct PoolOptions
+	 * @brief Per-host limits of a ClientPool.
+	 */
+	struct STORMBYTE_NETWORK_PUBLIC PoolOptions {
+		unsigned int min_connections = 0;		///< Kept open per host (opened by ClientPool::Warm())
+		unsigned int max_connections = 8;		///< Open per host; further requests wait for one to be returned
+		unsigned int acquire_timeout = 5000;	///< Milliseconds to wait for a connection (0 = forever)
+		unsigned int idle_timeout = 60000;		///< Milliseconds an idle connection above the minimum stays open (0 = forever)
+	};
+
+	/**
+	 * @struct PoolStats
+	 * @brief ClientPool counters (of one host or all of them).
+	 */
+	struct STORMBYTE_NETWORK_PUBLIC PoolStats {
+		std::size_t idle = 0;						///< Open connections waiting to be acquired
+		std::size_t in_use = 0;						///< Connections currently leased
+		std::uint64_t created = 0;					///< Connections opened
+		std::uint64_t evicted = 0;					///< Connections closed as broken, discarded or idle
+		std::uint64_t acquired = 0;					///< Successful acquisitions
+		std::uint64_t waited = 0;					///< Acquisitions that found the host at its limit
+		std::uint64_t failed = 0;					///< Acquisitions that timed out or could not connect
+		std::chrono::microseconds wait_total {};	///< Time spent in acquisitions (including connecting)
+		std::chrono::microseconds wait_max {};		///< Longest acquisition
+	};
+}
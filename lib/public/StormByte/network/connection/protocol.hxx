@@ -42,17 +42,19 @@ namespace StormByte::Network::Connection {
 	enum class STORMBYTE_NETWORK_PUBLIC Protocol: int {
 		IPv4 = AF_INET,		///< IPv4 (AF_INET)
 		IPv6 = AF_INET6,	///< IPv6 (AF_INET6)
+		Any = AF_UNSPEC,	///< Either family, whatever the host resolves to (clients only)
 	};
 
 	/**
 	 * Converts a Protocol to a human-readable string.
 	 * @param protocol Protocol value.
-	 * @return "IPv4", "IPv6", or "Unknown".
+	 * @return "IPv4", "IPv6", "Any", or "Unknown".
 	 */
 	constexpr STORMBYTE_NETWORK_PUBLIC std::string ProtocolString(const Protocol& protocol) noexcept {
 		switch (protocol) {
 			case Protocol::IPv4:	return "IPv4";
 			case Protocol::IPv6:	return "IPv6";
+			case Protocol::Any:		return "Any";
 			default:				return "Unknown";
 		}
 	}
@@ -60,7 +62,7 @@ namespace StormByte::Network::Connection {
 	/**
 	 * Converts a Protocol to the underlying AF_* integer.
 	 * @param protocol Protocol value.
-	 * @return AF_INET or AF_INET6.
+	 * @return AF_INET, AF_INET6 or AF_UNSPEC.
 	 */
 	constexpr STORMBYTE_NETWORK_PUBLIC int ProtocolInt(const Protocol& protocol) noexcept {
 		return static_cast<int>(protocol);
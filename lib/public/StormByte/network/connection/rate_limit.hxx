@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <StormByte/network/transport/packet.hxx>
+#include <StormByte/network/visibility.h>
+
+#include <cstdint>
+#include <unordered_map>
+
+/**
+ * @namespace Connection
+ * @brief Connection-level types (protocol, status, read/write results).
+ */
+namespace StormByte::Network::Connection {
+	/**
+	 * @enum RateLimitAction
+	 * @brief What a server does with a frame received over its client's rate.
+	 */
+	enum class STORMBYTE_NETWORK_PUBLIC RateLimitAction: std::uint8_t {
+		Delay,			///< Handle it once within the rate, not reading meanwhile (TCP backpressure slows the client)
+		Reject,			///< Answer it with Transport::Control::Busy
+		Disconnect,		///< Disconnect the client
+	};
+
+	/**
+	 * @struct RateLimit
+	 * @brief Token bucket: @ref rate frames per second on average, bursts of
+	 * up to @ref burst frames.
+	 */
+	struct STORMBYTE_NETWORK_PUBLIC RateLimit {
+		unsigned int rate = 0;		///< Frames per second (0 = unlimited)
+		unsigned int burst = 0;		///< Bucket size in frames (0 = @ref rate)
+	};
+
+	/**
+	 * @struct RateLimitOptions
+	 * @brief Per-connection rate limits a server applies to received frames.
+	 *
+	 * Every frame after the handshake takes a token from the @ref connection
+	 * bucket and, if its opcode has one, from its @ref opcodes bucket; each
+	 * packet of a batch counts as a frame. Buckets belong to the connection's
+	 * receive thread, so checking them takes no locks and reads only a
+	 * coarse clock.
+	 */
+	struct STORMBYTE_NETWORK_PUBLIC RateLimitOptions {
+		RateLimitAction action = RateLimitAction::Delay;					///< Action for frames over a limit
+		RateLimit connection;												///< Limit for all frames of a connection
+		std::unordered_map<Transport::Packet::OpcodeType, RateLimit> opcodes;	///< Additional limits per opcode
+	};
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <StormByte/network/visibility.h>
+
+#include <cstddef>
+
+/**
+ * @namespace Connection
+ * @brief Connection-level types (protocol, status, read/write results).
+ */
+namespace StormByte::Network::Connection {
+	/**
+	 * @struct SendQueueOptions
+	 * @brief Watermarks of the per-connection outbound queue.
+	 *
+	 * Frames are written straight to the socket while it keeps up; the rest
+	 * is queued and written as the socket becomes writable. Once the queued
+	 * bytes reach @ref high_watermark the connection stops being writable:
+	 * request / reply senders wait and fan-out (broadcast, publications)
+	 * skips it, until the queue drains to @ref low_watermark.
+	 */
+	struct STORMBYTE_NETWORK_PUBLIC SendQueueOptions {
+		std::size_t high_watermark = 4 * 1024 * 1024;	///< Queued bytes at which the connection stops being writable
+		std::size_t low_watermark = 1024 * 1024;		///< Queued bytes at which it is writable again
+	};
+}
@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <StormByte/network/visibility.h>
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @namespace Connection
+ * @brief Connection-level types (protocol, status, read/write results).
+ */
+namespace StormByte::Network::Connection {
+	/**
+	 * @struct ShardingOptions
+	 * @brief Fixed shard threads for requests carrying a shard key.
+	 *
+	 * Requests for which @ref Server::ShardKey() returns a key are handled
+	 * by shard thread key % shards, in the order they were received. All
+	 * requests for one key (entity) therefore run sequentially on the same
+	 * thread, so handlers need no locks for per-entity state, while
+	 * different keys run in parallel. Requests of one connection with
+	 * different keys may be answered out of order.
+	 */
+	struct STORMBYTE_NETWORK_PUBLIC ShardingOptions {
+		std::size_t shards = 0;					///< Shard threads (0 = off)
+		std::size_t queue_capacity = 1024;		///< Requests each shard holds before senders wait
+		std::vector<unsigned int> cpus;			///< Shard i is pinned to cpus[i % cpus.size()] (empty = not pinned; Linux only)
+	};
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <StormByte/network/visibility.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @namespace Connection
+ * @brief Connection-level types (protocol, status, read/write results).
+ */
+namespace StormByte::Network::Connection {
+	/**
+	 * @enum SlowConsumerPolicy
+	 * @brief How a server treats a client that does not keep up with its
+	 * send queue.
+	 *
+	 * Only fan-out frames (broadcasts and publications) are ever dropped;
+	 * replies are delivered or the client is disconnected.
+	 */
+	enum class STORMBYTE_NETWORK_PUBLIC SlowConsumerPolicy: std::uint8_t {
+		Disconnect,		///< Disconnect the client
+		DropOldest,		///< Drop its oldest unsent fan-out frames; disconnect only if nothing can be dropped
+		Conflate,		///< Like DropOldest, and an unsent publication is always replaced by a newer one of the same topic
+	};
+
+	/**
+	 * @struct SlowConsumerOptions
+	 * @brief Limits a server enforces on every client send queue.
+	 *
+	 * A client is slow when its queue makes no progress for @ref max_stall,
+	 * or when a fan-out frame would take it over @ref max_queued_bytes.
+	 * Senders waiting on a slow client give up after @ref max_stall instead
+	 * of blocking their thread indefinitely.
+	 */
+	struct STORMBYTE_NETWORK_PUBLIC SlowConsumerOptions {
+		SlowConsumerPolicy policy = SlowConsumerPolicy::Disconnect;	///< What to do with a slow client
+		std::size_t max_queued_bytes = 0;							///< Queued bytes tolerated for fan-out frames (0 = only the SendQueueOptions watermarks)
+		unsigned int max_stall = 30000;								///< Milliseconds a non-empty queue may go without progress (0 = unlimited)
+	};
+
+	/**
+	 * @struct SendStats
+	 * @brief Send-progress counters of one connection.
+	 */
+	struct STORMBYTE_NETWORK_PUBLIC SendStats {
+		std::size_t queued_bytes = 0;				///< Bytes waiting to be written
+		std::size_t queued_frames = 0;				///< Frames waiting (fully or partially) to be written
+		std::chrono::milliseconds stalled {};		///< Time since the queue last made progress (0 when empty)
+		std::uint64_t sent_bytes = 0;				///< Bytes written so far
+		std::uint64_t dropped_frames = 0;			///< Fan-out frames dropped or conflated by the policy
+		bool writable = true;						///< Below the high watermark (see SendQueueOptions)
+	};
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <StormByte/network/visibility.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @namespace Connection
+ * @brief Connection-level types (protocol, status, read/write results).
+ */
+namespace StormByte::Network::Connection {
+	/**
+	 * @struct StagingOptions
+	 * @brief Splits request handling into an I/O stage and a handler stage.
+	 *
+	 * With staging on, a client's thread only reads frames, applies the
+	 * cheap checks (handshake, rate limits, admission) and hands the frame,
+	 * still in wire form, to a bounded pool of stage threads over lock-free
+	 * queues. Stage threads run the input pipeline, deserialization,
+	 * @ref Server::ProcessClientPacket() and the output pipeline; writes go
+	 * through the connection's outbound queue. Frames of one connection are
+	 * staged in arrival order, one at a time, so replies keep their order.
+	 *
+	 * Stage threads schedule connections with work stealing: each keeps its
+	 * own queue of ready connections, served newest first, and idle threads
+	 * steal the oldest ones from busy threads, so skewed load still keeps
+	 * every thread busy.
+	 */
+	struct STORMBYTE_NETWORK_PUBLIC StagingOptions {
+		std::size_t workers = 0;				///< Stage threads (0 = off: every client thread handles its own frames)
+		std::size_t queue_capacity = 1024;		///< Connections with frames waiting that the shared and each per-thread queue hold
+		std::size_t lane_capacity = 64;			///< Frames a connection may have waiting before its thread stops reading
+		std::vector<unsigned int> cpus;			///< Stage thread i is pinned to cpus[i % cpus.size()] (empty = not pinned; Linux only)
+	};
+
+	/**
+	 * @struct SchedulerStats
+	 * @brief Stage scheduler counters, for tuning @ref StagingOptions.
+	 */
+	struct STORMBYTE_NETWORK_PUBLIC SchedulerStats {
+		std::uint64_t executed = 0;				///< Tasks (decode, handle, reply) started so far
+		std::uint64_t steals = 0;				///< Connections taken from another thread's queue
+		std::size_t shared_depth = 0;			///< Connections waiting in the shared queue
+		std::vector<std::size_t> queue_depths;	///< Connections waiting in each thread's queue
+	};
+}
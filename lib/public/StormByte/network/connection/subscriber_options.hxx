@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <StormByte/network/visibility.h>
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @namespace Connection
+ * @brief Connection-level types (protocol, status, read/write results).
+ */
+namespace StormByte::Network::Connection {
+	/**
+	 * @enum QueuePolicy
+	 * @brief How a subscriber queue makes room for new publications.
+	 */
+	enum class STORMBYTE_NETWORK_PUBLIC QueuePolicy: std::uint8_t {
+		DropOldest,		///< When full, discard the oldest queued publication
+		DropNewest,		///< When full, discard the new publication
+		Conflate,		///< Keep only the latest queued publication per topic; when full, discard the oldest
+	};
+
+	/**
+	 * @struct SubscriberOptions
+	 * @brief Per-subscriber publication queue, see Server::Publish().
+	 *
+	 * Publications are queued per subscriber and written by the shared
+	 * worker pool, so a slow subscriber only delays (and eventually loses)
+	 * its own publications.
+	 */
+	struct STORMBYTE_NETWORK_PUBLIC SubscriberOptions {
+		std::size_t queue_size = 1024;					///< Publications queued per subscriber (at least 1)
+		QueuePolicy policy = QueuePolicy::DropOldest;	///< How room is made for new publications
+	};
+}
@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <StormByte/network/visibility.h>
+
+#include <vector>
+
+/**
+ * @namespace Connection
+ * @brief Connection-level types (protocol, status, read/write results).
+ */
+namespace StormByte::Network::Connection {
+	/**
+	 * @struct ThreadPerCoreOptions
+	 * @brief Gives every accepted connection to one core.
+	 *
+	 * Each connection is assigned to the listed core with the fewest
+	 * connections. Its thread is pinned there and reads, decodes and
+	 * handles every frame inline, allocating its buffers on the core's NUMA
+	 * node, so the hot path of a connection never leaves its core. The
+	 * staging pool is not used in this mode; shard keys and dispatch routes
+	 * still hand requests to their own (possibly pinned) threads.
+	 */
+	struct STORMBYTE_NETWORK_PUBLIC ThreadPerCoreOptions {
+		std::vector<unsigned int> cpus;		///< Cores owning connections (empty = off; pinning is Linux only)
+		bool local_memory = true;			///< Force NUMA-local allocation on connection threads (needs libnuma)
+	};
+}
@@ -1,5 +1,6 @@
 #include <StormByte/network/connection/client.hxx>
 #include <StormByte/network/endpoint.hxx>
+#include <StormByte/network/transport/codec.hxx>
 
 using namespace StormByte::Network;
 
@@ -23,7 +24,65 @@ bool Endpoint::Reply(std::shared_ptr<Connection::Client> client_connection, cons
 std::shared_ptr<Connection::Client> Endpoint::CreateConnection(std::shared_ptr<Socket::Client> socket) noexcept {
 	Buffer::Pipeline in_pipeline = InputPipeline();
 	Buffer::Pipeline out_pipeline = OutputPipeline();
-	return std::make_shared<Connection::Client>(socket, std::move(in_pipeline), std::move(out_pipeline));
+	const Connection::HandshakeOptions handshake = Handshake();
+	auto connection = std::make_shared<Connection::Client>(socket, std::move(in_pipeline), std::move(out_pipeline), SharedCodec(), handshake.max_frame_size, FrameChecksum(), SendQueue(), m_logger);
+	connection->Negotiating(handshake.enabled);
+	return connection;
+}
+
+Transport::Compression::Options Endpoint::CompressionOptions() const noexcept {
+	return {};
+}
+
+Connection::HandshakeOptions Endpoint::Handshake() const noexcept {
+	return {};
+}
+
+bool Endpoint::FrameChecksum() const noexcept {
+	return false;
+}
+
+Connection::SendQueueOptions Endpoint::SendQueue() const noexcept {
+	return {};
+}
+
+Connection::Capabilities Endpoint::LocalCapabilities() noexcept {
+	using Transport::Compression::Algorithm;
+
+	Connection::Capabilities capabilities;
+	capabilities.features = static_cast<std::uint32_t>(Connection::Feature::FrameFlags) | static_cast<std::uint32_t>(Connection::Feature::Compression)
+		| static_cast<std::uint32_t>(Connection::Feature::Checksum) | static_cast<std::uint32_t>(Connection::Feature::Batch)
+		| static_cast<std::uint32_t>(Connection::Feature::PubSub) | static_cast<std::uint32_t>(Connection::Feature::Busy)
+		| static_cast<std::uint32_t>(Connection::Feature::Heartbeat);
+	capabilities.max_frame_size = Handshake().max_frame_size;
+	for (const auto& algorithm : { Algorithm::None, Algorithm::LZ4, Algorithm::Zstd }) {
+		if (Transport::Compression::IsAvailable(algorithm))
+			capabilities.compression |= static_cast<std::uint8_t>(1u << static_cast<std::uint8_t>(algorithm));
+	}
+	capabilities.dictionaries = SharedCodec()->DictionaryIDs();
+	return capabilities;
+}
+
+void Endpoint::ApplyCapabilities(std::shared_ptr<Connection::Client> client_connection, const Connection::Capabilities& peer) noexcept {
+	const Connection::Capabilities negotiated = LocalCapabilities().Intersect(peer);
+	client_connection->Negotiated(negotiated, SharedCodec()->Restrict(negotiated.compression, negotiated.dictionaries));
+	client_connection->Negotiating(false);
+	m_logger << Logger::Level::LowLevel << "Negotiated protocol version " << negotiated.version
+			<< " (features " << negotiated.features << ")" << std::endl;
+}
+
+const std::shared_ptr<const Transport::Codec>& Endpoint::SharedCodec() noexcept {
+	if (!m_codec) {
+		// Dictionaries are digested once and shared by every connection
+		Transport::Compression::Options options = CompressionOptions();
+		if (!Transport::Compression::IsAvailable(options.algorithm)) {
+			m_logger << Logger::Level::Warning << "Compression algorithm " << Transport::Compression::AlgorithmString(options.algorithm)
+					<< " is not available; sending uncompressed" << std::endl;
+			options.algorithm = Transport::Compression::Algorithm::None;
+		}
+		m_codec = std::make_shared<const Transport::Codec>(options);
+	}
+	return m_codec;
 }
 
 bool Endpoint::SendPacket(std::shared_ptr<Connection::Client> client_connection, const Transport::Packet& packet) noexcept {
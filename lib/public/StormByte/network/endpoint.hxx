@@ -21,6 +21,9 @@
 
 #include <StormByte/buffer/pipeline.hxx>
 #include <StormByte/logger/threaded_log.hxx>
+#include <StormByte/network/connection/capabilities.hxx>
+#include <StormByte/network/connection/send_queue_options.hxx>
+#include <StormByte/network/transport/compression.hxx>
 #include <StormByte/network/typedefs.hxx>
 
 /**
@@ -32,13 +35,18 @@ namespace StormByte::Network {
 		class Client;	///< Forward declaration
 	}
 
+	namespace Transport {
+		class Codec;	///< Forward declaration
+	}
+
 	/**
 	 * @class Endpoint
 	 * @brief Shared base for Client and Server endpoints.
 	 *
 	 * Not instantiated directly. Override @ref InputPipeline() /
-	 * @ref OutputPipeline() for buffer stages; use @ref Send() / @ref Reply()
-	 * for framed request/response.
+	 * @ref OutputPipeline() for buffer stages, @ref CompressionOptions()
+	 * for built-in compression and @ref Handshake() for capability
+	 * negotiation; use @ref Send() / @ref Reply() for framed request/response.
 	 *
 	 * @note **Inheritance-oriented.** Derive application clients/servers from
 	 * @ref Client / @ref Server, not from Endpoint alone.
@@ -98,6 +106,7 @@ namespace StormByte::Network {
 		protected:
 			DeserializePacketFunction m_deserialize_packet_function;	///< Packet factory
 			std::shared_ptr<Logger::Log> m_logger;						///< Logger
+			std::shared_ptr<const Transport::Codec> m_codec;			///< Compression codec (built on first connection)
 
 			/**
 			 * Wraps a socket client with input/output pipelines.
@@ -116,6 +125,50 @@ namespace StormByte::Network {
 			 */
 			virtual Buffer::Pipeline OutputPipeline() const noexcept = 0;
 
+			/**
+			 * Compression for outbound payloads (opcodes >= Packet::PROCESS_THRESHOLD),
+			 * applied before @ref OutputPipeline() once the @ref Handshake()
+			 * agreed on an algorithm. Inbound payloads are decompressed whenever
+			 * the peer compressed them.
+			 * @return Compression options (default: no compression).
+			 */
+			virtual Transport::Compression::Options CompressionOptions() const noexcept;
+
+			/**
+			 * Capability handshake performed right after connect / accept.
+			 * Without it the peer is treated as a legacy one, so frame flags
+			 * and optional features (batches, publish/subscribe, busy
+			 * replies, heartbeats) stay off.
+			 * @return Handshake options (default: disabled).
+			 */
+			virtual Connection::HandshakeOptions Handshake() const noexcept;
+
+			/**
+			 * Appends a CRC32C of the payload to outbound frames when the peer
+			 * negotiated checksums in the @ref Handshake(). Inbound checksums
+			 * are always verified.
+			 * @return true to checksum outbound frames (default: false).
+			 */
+			virtual bool FrameChecksum() const noexcept;
+
+			/**
+			 * @return Outbound queue watermarks for new connections (default: SendQueueOptions defaults).
+			 */
+			virtual Connection::SendQueueOptions SendQueue() const noexcept;
+
+			/**
+			 * @return Capabilities this endpoint announces in the handshake.
+			 */
+			Connection::Capabilities LocalCapabilities() noexcept;
+
+			/**
+			 * Applies the peer's capabilities to @p client_connection and
+			 * leaves the Negotiating state.
+			 * @param client_connection Connection being negotiated.
+			 * @param peer Peer capabilities (Capabilities::Legacy() for old peers).
+			 */
+			void ApplyCapabilities(std::shared_ptr<Connection::Client> client_connection, const Connection::Capabilities& peer) noexcept;
+
 			/**
 			 * Sends @p packet and waits for a response frame.
 			 * @param client_connection Active connection.
@@ -133,6 +186,11 @@ namespace StormByte::Network {
 			bool Reply(std::shared_ptr<Connection::Client> client_connection, const Transport::Packet& packet) noexcept;
 
 		private:
+			/**
+			 * @return Endpoint codec, built from @ref CompressionOptions() on first use.
+			 */
+			const std::shared_ptr<const Transport::Codec>& SharedCodec() noexcept;
+
 			/**
 			 * Internal send helper (no receive).
 			 * @param client_connection Active connection.
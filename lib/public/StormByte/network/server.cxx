@@ -1,14 +1,62 @@
+#include <StormByte/network/connection/budget.hxx>
 #include <StormByte/network/connection/client.hxx>
+#include <StormByte/network/connection/handshake.hxx>
+#include <StormByte/network/connection/rate_limiter.hxx>
+#include <StormByte/network/connection/sharded_registry.hxx>
+#include <StormByte/network/connection/topics.hxx>
+#include <StormByte/network/executor/cores.hxx>
+#include <StormByte/network/executor/dispatcher.hxx>
+#include <StormByte/network/executor/pool.hxx>
+#include <StormByte/network/executor/shards.hxx>
+#include <StormByte/network/executor/stage.hxx>
+#include <StormByte/network/executor/timer_wheel.hxx>
 #include <StormByte/network/server.hxx>
 #include <StormByte/network/socket/server.hxx>
+#include <StormByte/network/transport/batch.hxx>
+#include <StormByte/network/transport/control_packet.hxx>
+#include <StormByte/network/transport/heartbeat.hxx>
+#include <StormByte/network/transport/publication.hxx>
+#include <StormByte/network/transport/shared_frame.hxx>
 
 using namespace StormByte::Network;
 
+/**
+ * @struct Server::ClientSlot
+ * @brief Registry entry for one accepted client.
+ */
+struct Server::ClientSlot {
+	std::shared_ptr<Connection::Client> connection;	///< Client connection
+	std::thread worker;								///< Communication thread
+	std::size_t core = 0;							///< Owning core (thread-per-core mode)
+	std::uint64_t idle_timer = 0;					///< Idle check timer (0 = no idle timeout)
+	std::uint64_t heartbeat_timer = 0;				///< Heartbeat timer (0 = no heartbeats)
+};
+
+/**
+ * @class Server::ClientRegistry
+ * @brief Client slots sharded by Connection::ID.
+ */
+class Server::ClientRegistry final: public Connection::ShardedRegistry<ClientSlot> {};
+
 Server::Server(const DeserializePacketFunction& deserialize_packet_function, std::shared_ptr<Logger::Log> logger) noexcept:
 	Endpoint(deserialize_packet_function, logger),
 	m_socket_server(nullptr),
 	m_status(Connection::Status::Disconnected),
-	m_accept_thread()
+	m_accept_thread(),
+	m_clients(std::make_unique<ClientRegistry>()),
+	m_topics(std::make_unique<Connection::Topics>()),
+	m_evicted(0),
+	m_budget(std::make_shared<Connection::Budget>(Connection::AdmissionOptions {})),
+	m_rate_limited(0),
+	m_dispatcher(nullptr),
+	m_routes(),
+	m_stage(nullptr),
+	m_shards(nullptr),
+	m_cores(nullptr),
+	m_idle(0),
+	m_unresponsive(0),
+	m_retired_mutex(),
+	m_retired()
 {}
 
 Server::~Server() noexcept {
@@ -23,6 +71,32 @@ bool Server::Connect(const Connection::Protocol& protocol, const std::string& ad
 
 	try {
 		m_socket_server = std::make_unique<Socket::Server>(protocol, m_logger);
+		m_budget = std::make_shared<Connection::Budget>(Admission());
+
+		Connection::DispatchOptions dispatch = Dispatch();
+		m_routes.clear();
+		for (const auto& [opcode, handler_class] : dispatch.routes) {
+			if (handler_class < dispatch.classes.size())
+				m_routes.emplace(opcode, handler_class);
+			else
+				m_logger << Logger::Level::Warning << "Ignoring route of opcode " << opcode << " to unknown handler class " << handler_class << std::endl;
+		}
+		if (!m_routes.empty())
+			m_dispatcher = std::make_unique<Executor::Dispatcher>(dispatch.classes);
+
+		const Connection::ThreadPerCoreOptions thread_per_core = ThreadPerCore();
+		if (!thread_per_core.cpus.empty())
+			m_cores = std::make_unique<Executor::Cores>(thread_per_core);
+
+		const Connection::StagingOptions staging = Staging();
+		if (staging.workers > 0 && m_cores)
+			m_logger << Logger::Level::Warning << "Staging is not used in thread-per-core mode" << std::endl;
+		else if (staging.workers > 0)
+			m_stage = std::make_unique<Executor::Stage>(staging);
+
+		const Connection::ShardingOptions sharding = Sharding();
+		if (sharding.shards > 0)
+			m_shards = std::make_unique<Executor::Shards>(sharding);
 
 		if (!m_socket_server->Listen(address, port)) {
 			m_logger << Logger::Level::Error << "Failed to listen on " << address << ":" << port
@@ -70,19 +144,32 @@ void Server::Disconnect() noexcept {
 		m_accept_thread.join();
 	}
 
-	// 4) Snapshot client UUIDs (no join under mutex)
-	std::vector<std::string> client_uuids;
-	{
-		std::scoped_lock lock_guard(m_mutex);
-		client_uuids.reserve(m_clients.size());
-		for (const auto& [uuid, _] : m_clients) {
-			client_uuids.push_back(uuid);
-		}
+	// 4) Snapshot client IDs (no join under the registry locks)
+	std::vector<Connection::ID> client_ids;
+	client_ids.reserve(m_clients->Size());
+	m_clients->ForEach([&client_ids](const Connection::ID& id, ClientSlot&) {
+		client_ids.push_back(id);
+	});
+
+	for (const auto& id : client_ids) {
+		DisconnectClient(id);
 	}
 
-	for (const auto& uuid : client_uuids) {
-		DisconnectClient(uuid);
+	// Workers reference this server, so their handed-off joins must be done before it goes
+	std::vector<std::future<void>> retired;
+	{
+		std::lock_guard<std::mutex> lock(m_retired_mutex);
+		retired.swap(m_retired);
 	}
+	for (auto& join : retired) {
+		join.wait();
+	}
+
+	// Drops queued requests; their clients are gone. Stage tasks may still submit to shards and the dispatcher
+	m_stage.reset();
+	m_shards.reset();
+	m_dispatcher.reset();
+	m_cores.reset();
 
 	// 5) Now safe: no accept thread using the listen fd
 	m_socket_server->Disconnect();
@@ -90,50 +177,214 @@ void Server::Disconnect() noexcept {
 	m_status.store(Connection::Status::Disconnected, std::memory_order_release);
 }
 
-void Server::DisconnectClient(const std::string& uuid) noexcept {
-	std::thread thread_to_join;
-	std::shared_ptr<Connection::Client> client;
+void Server::DisconnectClient(const Connection::ID& client_id) noexcept {
+	std::optional<ClientSlot> slot = m_clients->Erase(client_id);
+	if (!slot) {
+		return;
+	}
+	m_topics->Remove(client_id);
+	m_budget->ReleaseConnection();
+	for (const std::uint64_t& timer : { slot->idle_timer, slot->heartbeat_timer }) {
+		// Waits for a running check, so it never touches a closed socket
+		if (timer != 0)
+			Executor::TimerWheel::Instance().Cancel(timer);
+	}
+	if (slot->connection) {
+		// Returns once no writability callback into this server is running
+		slot->connection->OnWritabilityChange(nullptr);
+	}
 
-	{
-		std::scoped_lock lock_guard(m_mutex);
+	// Socket I/O outside the registry lock
+	if (slot->connection && slot->connection->Socket()) {
+		slot->connection->Socket()->Disconnect();
+		m_logger << Logger::Level::LowLevel << "Disconnected client: " << client_id.ToString() << std::endl;
+	}
 
-		auto it = m_clients.find(uuid);
-		if (it != m_clients.end()) {
-			client = it->second;
-			m_clients.erase(it);
+	if (slot->worker.joinable()) {
+		if (slot->worker.get_id() == std::this_thread::get_id()) {
+			// Called from the worker itself: detach so we never self-join
+			slot->worker.detach();
+		} else {
+			// A shard or stage thread must not wait here: the worker may be waiting for room in its queue
+			std::future<void> join = Executor::Pool::Instance().Submit([worker = std::move(slot->worker)] mutable {
+				worker.join();
+			});
+			std::lock_guard<std::mutex> lock(m_retired_mutex);
+			std::erase_if(m_retired, [](const std::future<void>& pending) {
+				return pending.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+			});
+			m_retired.push_back(std::move(join));
 		}
+	}
+}
 
-		auto thread_it = m_handle_msg_threads.find(uuid);
-		if (thread_it != m_handle_msg_threads.end()) {
-			if (thread_it->second.get_id() == std::this_thread::get_id()) {
-				// Called from the worker itself: detach so we never self-join
-				if (thread_it->second.joinable()) {
-					thread_it->second.detach();
-				}
-				m_handle_msg_threads.erase(thread_it);
-			} else {
-				thread_to_join = std::move(thread_it->second);
-				m_handle_msg_threads.erase(thread_it);
-			}
+std::string Server::ClientUUID(const Connection::ID& client_id) noexcept {
+	std::shared_ptr<Connection::Client> client;
+	m_clients->Read(client_id, [&client](const ClientSlot& slot) {
+		client = slot.connection;
+	});
+	return client && client->Socket() ? client->Socket()->UUID() : std::string();
+}
+
+std::size_t Server::Broadcast(const Transport::Packet& packet, const std::function<bool(const Connection::ID&)>& filter) noexcept {
+	// Snapshot recipients; no socket I/O under the registry locks
+	std::vector<std::pair<Connection::ID, std::shared_ptr<Connection::Client>>> targets;
+	targets.reserve(m_clients->Size());
+	m_clients->ForEach([&targets, &filter](const Connection::ID& id, ClientSlot& slot) {
+		// Negotiating clients have no agreed encoding yet
+		if (slot.connection && slot.connection->Status() == Connection::Status::Connected && (!filter || filter(id)))
+			targets.emplace_back(id, slot.connection);
+	});
+	if (targets.empty())
+		return 0;
+
+	Transport::SharedFrame frame { Transport::Frame(packet) };
+	std::size_t sent = 0;
+	for (const auto& [id, client] : targets) {
+		// A backed-up client is skipped rather than letting its queue grow
+		if (!client->Writable()) {
+			m_logger << Logger::Level::Warning << "Broadcast: skipping backed-up client=" << id.ToString() << std::endl;
+			continue;
 		}
+		if (client->SendEncoded(frame.For(client, m_logger), {}, m_logger))
+			++sent;
+		else
+			m_logger << Logger::Level::Error << "Broadcast: failed to send to client=" << id.ToString() << std::endl;
 	}
 
-	// Socket I/O outside the map lock
-	if (client && client->Socket()) {
-		client->Socket()->Disconnect();
-		m_logger << Logger::Level::LowLevel << "Disconnected client: " << uuid << std::endl;
+	m_logger << Logger::Level::LowLevel << "Broadcast: sent to " << sent << "/" << targets.size() << " clients using "
+			<< frame.Encodings() << " encoding(s)" << std::endl;
+	return sent;
+}
+
+std::size_t Server::Publish(const std::string& topic, const Transport::Packet& packet) noexcept {
+	auto subscribers = m_topics->Subscribers(topic);
+	if (!subscribers)
+		return 0;
+
+	auto expected_frame = Transport::Publication::Wrap(topic, packet);
+	if (!expected_frame) {
+		m_logger << Logger::Level::Error << "Publish: " << expected_frame.error()->what() << std::endl;
+		return 0;
 	}
 
-	if (thread_to_join.joinable()) {
-		thread_to_join.join();
+	Transport::SharedFrame frame(std::move(expected_frame.value()));
+	for (const auto& subscriber : *subscribers) {
+		if (subscriber->Push(topic, frame.For(subscriber->Peer(), m_logger))) {
+			Executor::Pool::Instance().Submit([subscriber, logger = m_logger] {
+				subscriber->Drain(logger);
+			});
+		}
 	}
+	return subscribers->size();
+}
+
+Connection::SubscriberOptions Server::Subscriptions() const noexcept {
+	return {};
+}
+
+void Server::ClientWritabilityChanged(const Connection::ID&, const bool&) noexcept {}
+
+Connection::SlowConsumerOptions Server::SlowConsumers() const noexcept {
+	return {};
+}
+
+std::optional<Connection::SendStats> Server::ClientSendStats(const Connection::ID& client_id) noexcept {
+	std::shared_ptr<Connection::Client> client;
+	m_clients->Read(client_id, [&client](const ClientSlot& slot) {
+		client = slot.connection;
+	});
+	if (!client)
+		return std::nullopt;
+	return client->Stats();
+}
+
+std::uint64_t Server::EvictedClients() const noexcept {
+	return m_evicted.load(std::memory_order_relaxed);
+}
+
+Connection::AdmissionOptions Server::Admission() const noexcept {
+	return {};
+}
+
+Connection::AdmissionStats Server::Load() const noexcept {
+	return m_budget->Stats();
+}
+
+Connection::RateLimitOptions Server::RateLimits() const noexcept {
+	return {};
+}
+
+std::uint64_t Server::RateLimitedFrames() const noexcept {
+	return m_rate_limited.load(std::memory_order_relaxed);
+}
+
+Connection::DispatchOptions Server::Dispatch() const noexcept {
+	return {};
+}
+
+Connection::StagingOptions Server::Staging() const noexcept {
+	return {};
+}
+
+Connection::SchedulerStats Server::SchedulerStats() const noexcept {
+	return m_stage ? m_stage->Stats() : Connection::SchedulerStats {};
+}
+
+Connection::ShardingOptions Server::Sharding() const noexcept {
+	return {};
+}
+
+std::optional<std::uint64_t> Server::ShardKey(const Connection::ID&, const PacketPointer&) const noexcept {
+	return std::nullopt;
+}
+
+Connection::ThreadPerCoreOptions Server::ThreadPerCore() const noexcept {
+	return {};
+}
+
+std::vector<std::size_t> Server::CoreConnections() const noexcept {
+	return m_cores ? m_cores->Load() : std::vector<std::size_t> {};
+}
+
+unsigned int Server::IdleTimeout() const noexcept {
+	return 0;
+}
+
+std::uint64_t Server::IdleClients() const noexcept {
+	return m_idle.load(std::memory_order_relaxed);
+}
+
+Connection::HeartbeatOptions Server::Heartbeat() const noexcept {
+	return {};
+}
+
+std::optional<Connection::RoundTripStats> Server::ClientRoundTrip(const Connection::ID& client_id) noexcept {
+	std::shared_ptr<Connection::Client> client;
+	m_clients->Read(client_id, [&client](const ClientSlot& slot) {
+		client = slot.connection;
+	});
+	if (!client)
+		return std::nullopt;
+	return client->RoundTrip();
+}
+
+std::uint64_t Server::UnresponsiveClients() const noexcept {
+	return m_unresponsive.load(std::memory_order_relaxed);
 }
 
 void Server::AcceptClients() noexcept {
 	constexpr auto TIMEOUT = 1000000; // 1 second
+	constexpr auto SWEEP_INTERVAL = std::chrono::seconds(1);
 	m_logger << Logger::Level::LowLevel << "Started accept clients thread" << std::endl;
 
+	auto last_sweep = std::chrono::steady_clock::now();
 	while (Connection::IsConnected(m_status.load())) {
+		if (std::chrono::steady_clock::now() - last_sweep >= SWEEP_INTERVAL) {
+			EvictSlowConsumers();
+			last_sweep = std::chrono::steady_clock::now();
+		}
+
 		auto expected_wait = m_socket_server->WaitForData(TIMEOUT);
 		if (!expected_wait) {
 			m_logger << Logger::Level::Error << expected_wait.error()->what() << std::endl;
@@ -152,15 +403,45 @@ void Server::AcceptClients() noexcept {
 					break;
 				}
 
-				const std::string client_uuid = expected_client.value()->UUID();
-				{
-					std::scoped_lock lock_guard(m_mutex);
-					m_clients.emplace(client_uuid, CreateConnection(expected_client.value()));
-					m_handle_msg_threads.emplace(
-						client_uuid,
-						std::thread(&Server::HandleClientCommunication, this, client_uuid));
+				if (!m_budget->AdmitConnection()) {
+					m_logger << Logger::Level::Warning << "AcceptClients: connection limit reached; rejecting client" << std::endl;
+					// Closing lingers briefly, so keep it off the accept thread
+					Executor::Pool::Instance().Submit([socket = std::move(expected_client.value())] {
+						socket->Disconnect();
+					});
+					break;
 				}
-				m_logger << Logger::Level::LowLevel << "AcceptClients: accepted client uuid=" << client_uuid << std::endl;
+
+				std::shared_ptr<Connection::Client> connection = CreateConnection(expected_client.value());
+				connection->SlowConsumers(SlowConsumers());
+				connection->Charge(m_budget);
+				const std::size_t core = m_cores ? m_cores->Assign() : 0;
+				const Connection::ID client_id = m_clients->Insert(ClientSlot { .connection = connection, .worker = {}, .core = core });
+				connection->OnWritabilityChange([this, client_id](bool writable) {
+					ClientWritabilityChanged(client_id, writable);
+				});
+				const std::chrono::milliseconds idle_timeout(IdleTimeout());
+				const Connection::HeartbeatOptions heartbeat = Heartbeat();
+				// The worker reads its slot under the same shard lock, so it waits for this
+				m_clients->Modify(client_id, [this, &client_id, &connection, &idle_timeout, &heartbeat](ClientSlot& slot) {
+					Executor::TimerWheel& wheel = Executor::TimerWheel::Instance();
+					if (idle_timeout.count() > 0) {
+						slot.idle_timer = wheel.Schedule(idle_timeout, [this, client_id, idle_timeout] {
+							CheckIdle(client_id, idle_timeout);
+						});
+					}
+					if (heartbeat.interval > 0) {
+						slot.heartbeat_timer = wheel.Schedule(std::chrono::milliseconds(heartbeat.interval), [this, client_id, heartbeat] {
+							CheckHeartbeat(client_id, heartbeat);
+						});
+					}
+					if (slot.idle_timer != 0 || slot.heartbeat_timer != 0) {
+						// Stamped once a timer is armed, so the wheel clock is running
+						connection->Touch(wheel.Now());
+					}
+					slot.worker = std::thread(&Server::HandleClientCommunication, this, client_id);
+				});
+				m_logger << Logger::Level::LowLevel << "AcceptClients: accepted client id=" << client_id.ToString() << std::endl;
 				break;
 			}
 
@@ -180,21 +461,346 @@ void Server::AcceptClients() noexcept {
 	m_logger << Logger::Level::LowLevel << "Stopped accept clients thread" << std::endl;
 }
 
-void Server::HandleClientCommunication(const std::string& client_uuid) noexcept {
-	m_logger << Logger::Level::LowLevel << "Started communication thread for client uuid=" << client_uuid << std::endl;
+void Server::EvictSlowConsumers() noexcept {
+	const Connection::SlowConsumerOptions options = SlowConsumers();
+
+	// Snapshot clients; no socket I/O under the registry locks
+	std::vector<std::pair<Connection::ID, std::shared_ptr<Connection::Client>>> clients;
+	clients.reserve(m_clients->Size());
+	m_clients->ForEach([&clients](const Connection::ID& id, ClientSlot& slot) {
+		if (slot.connection)
+			clients.emplace_back(id, slot.connection);
+	});
 
+	for (const auto& [id, client] : clients) {
+		if (!client->Overflowed()) {
+			if (options.max_stall == 0)
+				continue;
+			const Connection::SendStats stats = client->Stats();
+			if (stats.stalled < std::chrono::milliseconds(options.max_stall))
+				continue;
+			if (options.policy != Connection::SlowConsumerPolicy::Disconnect) {
+				// Dropping fan-out frames gives the client another window; only replies left means it is gone
+				const std::size_t dropped = client->Shed();
+				if (dropped > 0) {
+					m_logger << Logger::Level::Warning << "Dropped " << dropped << " queued frames for stalled client="
+							<< id.ToString() << std::endl;
+					continue;
+				}
+			}
+		}
+
+		const Connection::SendStats stats = client->Stats();
+		m_logger << Logger::Level::Warning << "Evicting slow client=" << id.ToString() << " (" << stats.queued_bytes
+				<< " bytes queued, stalled for " << stats.stalled.count() << " ms)" << std::endl;
+		DisconnectClient(id);
+		m_evicted.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+void Server::CheckIdle(const Connection::ID& client_id, const std::chrono::milliseconds& timeout) noexcept {
 	std::shared_ptr<Connection::Client> client;
-	{
-		std::scoped_lock lock_guard(m_mutex);
-		auto it = m_clients.find(client_uuid);
-		if (it == m_clients.end()) {
-			m_logger << Logger::Level::LowLevel << "Client uuid=" << client_uuid
-					<< " not found; ending communication thread" << std::endl;
-			return;
+	if (!m_clients->Read(client_id, [&client](const ClientSlot& slot) { client = slot.connection; }) || !client)
+		return;
+
+	Executor::TimerWheel& wheel = Executor::TimerWheel::Instance();
+	const std::uint64_t now = wheel.Now();
+	const std::uint64_t last = client->LastActivity();
+	const std::chrono::milliseconds idle = now > last ? static_cast<std::int64_t>(now - last) * Executor::TimerWheel::TICK : std::chrono::milliseconds::zero();
+	if (idle < timeout) {
+		const std::uint64_t timer = wheel.Schedule(timeout - idle, [this, client_id, timeout] {
+			CheckIdle(client_id, timeout);
+		});
+		// Disconnected meanwhile: nobody else would cancel it
+		if (!m_clients->Modify(client_id, [&timer](ClientSlot& slot) { slot.idle_timer = timer; }))
+			wheel.Cancel(timer);
+		return;
+	}
+
+	m_logger << Logger::Level::Warning << "Disconnecting idle client=" << client_id.ToString()
+			<< " (no frames for " << idle.count() << " ms)" << std::endl;
+	m_idle.fetch_add(1, std::memory_order_relaxed);
+	// Closing lingers, so only wake the worker: it sees the connection closed and disconnects it
+	client->Socket()->Interrupt();
+}
+
+void Server::CheckHeartbeat(const Connection::ID& client_id, const Connection::HeartbeatOptions& options) noexcept {
+	std::shared_ptr<Connection::Client> client;
+	if (!m_clients->Read(client_id, [&client](const ClientSlot& slot) { client = slot.connection; }) || !client)
+		return;
+
+	const Connection::Status status = client->Status();
+	if (status != Connection::Status::Negotiating && !client->Capabilities().Has(Connection::Feature::Heartbeat))
+		return;
+
+	Executor::TimerWheel& wheel = Executor::TimerWheel::Instance();
+	const std::uint64_t now = wheel.Now();
+	const std::uint64_t last = client->LastActivity();
+	const std::chrono::milliseconds silent = now > last ? static_cast<std::int64_t>(now - last) * Executor::TimerWheel::TICK : std::chrono::milliseconds::zero();
+	if (options.max_missed > 0 && silent >= std::chrono::milliseconds(options.interval) * options.max_missed) {
+		m_logger << Logger::Level::Warning << "Disconnecting unresponsive client=" << client_id.ToString()
+				<< " (silent for " << silent.count() << " ms)" << std::endl;
+		m_unresponsive.fetch_add(1, std::memory_order_relaxed);
+		client->Socket()->Interrupt();
+		return;
+	}
+
+	// Only queued, never waited for: a backed-up client skips this ping and is judged by its silence
+	if (status != Connection::Status::Negotiating && client->Writable()) {
+		auto ping = std::make_shared<const Buffer::DataType>(client->Encode(Transport::Frame(Transport::Heartbeat::Ping()), m_logger));
+		if (!client->SendEncoded(ping, {}, m_logger))
+			m_logger << Logger::Level::Warning << "Failed to queue heartbeat for client=" << client_id.ToString() << std::endl;
+	}
+
+	const std::uint64_t timer = wheel.Schedule(std::chrono::milliseconds(options.interval), [this, client_id, options] {
+		CheckHeartbeat(client_id, options);
+	});
+	if (!m_clients->Modify(client_id, [&timer](ClientSlot& slot) { slot.heartbeat_timer = timer; }))
+		wheel.Cancel(timer);
+}
+
+bool Server::RefuseRequest(std::shared_ptr<Connection::Client> client, const Connection::ID& client_id) noexcept {
+	if (!client->Capabilities().Has(Connection::Feature::Busy)) {
+		m_logger << Logger::Level::Warning << "Server overloaded; disconnecting client=" << client_id.ToString()
+				<< " which does not understand busy replies" << std::endl;
+		return false;
+	}
+
+	m_logger << Logger::Level::LowLevel << "Server overloaded; refusing request from client=" << client_id.ToString() << std::endl;
+	return Reply(client, Transport::ControlPacket(Transport::Control::Busy));
+}
+
+bool Server::HandleRequest(std::shared_ptr<Connection::Client> client, const Connection::ID& client_id, PacketPointer packet) noexcept {
+	if (!Connection::IsConnected(m_status.load())) {
+		return false;
+	}
+
+	PacketPointer response_packet = ProcessClientPacket(client_id, packet);
+	if (!response_packet) {
+		m_logger << Logger::Level::Error
+				<< "HandleRequest: response packet was null" << std::endl;
+		return false;
+	}
+
+	if (client->Socket()->HasShutdownRequest() || !Connection::IsConnected(m_status.load())) {
+		return false;
+	}
+
+	Reply(client, *response_packet);
+	return true;
+}
+
+bool Server::Enqueue(std::shared_ptr<Connection::Client> client, const std::shared_ptr<Executor::Lane>& lane, Executor::Stage::Task&& task) noexcept {
+	while (!m_stage->Post(lane, task)) {
+		// Lane full: stop reading until the stage catches up, so TCP backpressure reaches the client
+		if (!Connection::IsConnected(m_status.load()) || !Connection::IsConnected(client->Status())) {
+			return false;
+		}
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	return true;
+}
+
+bool Server::DecodeRequest(std::shared_ptr<Connection::Client> client, const Connection::ID& client_id, Transport::Frame& frame, PacketPointer& packet) noexcept {
+	if (!client->Decode(frame, m_logger)) {
+		m_logger << Logger::Level::Error << "Failed to decode frame from client=" << client_id.ToString() << std::endl;
+		return false;
+	}
+
+	if (frame.IsBatch() && client->Capabilities().Has(Connection::Feature::Batch)) {
+		std::optional<std::vector<Transport::Frame>> frames = SplitBatch(client_id, frame);
+		return frames && HandleBatch(client, client_id, frames.value());
+	}
+
+	packet = frame.ProcessPacket(m_deserialize_packet_function, m_logger);
+	if (!packet) {
+		m_logger << Logger::Level::Error << "Failed to process packet from client="
+				<< client_id.ToString() << std::endl;
+		return false;
+	}
+	return true;
+}
+
+bool Server::Throttle(Connection::RateLimiter& limiter, const Connection::ID& client_id, const Transport::Packet::OpcodeType& opcode) noexcept {
+	std::chrono::milliseconds wait = limiter.Take(opcode);
+	if (wait.count() == 0) {
+		return true;
+	}
+	m_rate_limited.fetch_add(1, std::memory_order_relaxed);
+
+	switch (limiter.Action()) {
+		case Connection::RateLimitAction::Delay: {
+			// Not reading meanwhile lets TCP backpressure slow the client down; slices keep shutdown prompt
+			constexpr auto SLICE = std::chrono::milliseconds(100);
+			while (wait.count() > 0 && Connection::IsConnected(m_status.load())) {
+				std::this_thread::sleep_for(std::min(wait, SLICE));
+				wait -= SLICE;
+			}
+			return true;
+		}
+
+		case Connection::RateLimitAction::Reject:
+			m_logger << Logger::Level::LowLevel << "Client=" << client_id.ToString() << " over its rate limit (opcode "
+					<< opcode << "); refusing frame" << std::endl;
+			return false;
+
+		default:
+			m_logger << Logger::Level::Warning << "Client=" << client_id.ToString() << " over its rate limit (opcode "
+					<< opcode << "); disconnecting" << std::endl;
+			return false;
+	}
+}
+
+bool Server::AcceptHandshake(std::shared_ptr<Connection::Client> client, const Transport::Frame& hello) noexcept {
+	auto expected_capabilities = Connection::Handshake::Deserialize(hello.Payload());
+	if (!expected_capabilities) {
+		m_logger << Logger::Level::Error << expected_capabilities.error()->what() << std::endl;
+		return false;
+	}
+
+	Transport::ControlPacket ack(Transport::Control::HelloAck, Connection::Handshake::Serialize(LocalCapabilities()));
+	if (!Reply(client, ack)) {
+		return false;
+	}
+
+	ApplyCapabilities(client, expected_capabilities.value());
+	return true;
+}
+
+std::optional<std::vector<Transport::Frame>> Server::SplitBatch(const Connection::ID& client_id, const Transport::Frame& batch) noexcept {
+	auto expected_frames = Transport::Batch::Split(batch);
+	if (!expected_frames) {
+		m_logger << Logger::Level::Error << "Malformed batch from client=" << client_id.ToString()
+				<< ": " << expected_frames.error()->what() << std::endl;
+		return std::nullopt;
+	}
+	return std::move(expected_frames.value());
+}
+
+bool Server::ThrottleBatch(Connection::RateLimiter& limiter, const Connection::ID& client_id, const std::vector<Transport::Frame>& frames) noexcept {
+	// Whole batch or nothing: no packet is handled if one is over the limit
+	for (const auto& frame : frames) {
+		if (!Throttle(limiter, client_id, frame.Opcode())) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool Server::HandleBatch(std::shared_ptr<Connection::Client> client, const Connection::ID& client_id, std::vector<Transport::Frame>& frames) noexcept {
+	Transport::Batch responses;
+	for (auto& frame : frames) {
+		PacketPointer packet = frame.ProcessPacket(m_deserialize_packet_function, m_logger);
+		if (!packet) {
+			m_logger << Logger::Level::Error << "Failed to process batched packet from client="
+					<< client_id.ToString() << std::endl;
+			return false;
+		}
+
+		if (!Connection::IsConnected(m_status.load())) {
+			return false;
+		}
+
+		PacketPointer response_packet = ProcessClientPacket(client_id, packet);
+		if (!response_packet) {
+			m_logger << Logger::Level::Error
+					<< "HandleBatch: response packet was null" << std::endl;
+			return false;
 		}
-		client = it->second;
+
+		if (!responses.Add(*response_packet)) {
+			m_logger << Logger::Level::Error << "HandleBatch: response packet too large to batch" << std::endl;
+			return false;
+		}
+	}
+
+	if (client->Socket()->HasShutdownRequest() || !Connection::IsConnected(m_status.load())) {
+		return false;
+	}
+
+	if (!client->Send(responses.Release(), m_logger)) {
+		m_logger << Logger::Level::Error << "Failed to send batch reply to client=" << client_id.ToString() << std::endl;
+		return false;
+	}
+	return true;
+}
+
+bool Server::ProcessSubscription(std::shared_ptr<Connection::Client> client, const Connection::ID& client_id, const Transport::Frame& request) noexcept {
+	const Buffer::DataType& payload = request.Payload();
+	if (payload.size() > Transport::Publication::MAX_TOPIC_SIZE) {
+		m_logger << Logger::Level::Error << "Topic of " << payload.size() << " bytes from client=" << client_id.ToString()
+				<< " exceeds the limit" << std::endl;
+		return false;
 	}
 
+	const std::string topic(reinterpret_cast<const char*>(payload.data()), payload.size());
+	const bool subscribe = Transport::IsControl(request.Opcode(), Transport::Control::Subscribe);
+	const bool changed = subscribe ? m_topics->Subscribe(topic, client_id, client, Subscriptions()) : m_topics->Unsubscribe(topic, client_id);
+	m_logger << Logger::Level::LowLevel << "Client id=" << client_id.ToString() << (subscribe ? " subscribed to " : " unsubscribed from ")
+			<< topic << (changed ? "" : " (no change)") << std::endl;
+
+	// Acknowledge with the request opcode so the client knows the request is applied
+	return Reply(client, Transport::ControlPacket(static_cast<Transport::Control>(request.Opcode())));
+}
+
+void Server::HandleClientCommunication(const Connection::ID& client_id) noexcept {
+	m_logger << Logger::Level::LowLevel << "Started communication thread for client id=" << client_id.ToString() << std::endl;
+
+	std::shared_ptr<Connection::Client> client;
+	std::size_t core = 0;
+	bool stamp_activity = false;
+	const bool found = m_clients->Read(client_id, [&client, &core, &stamp_activity](const ClientSlot& slot) {
+		client = slot.connection;
+		core = slot.core;
+		stamp_activity = slot.idle_timer != 0 || slot.heartbeat_timer != 0;
+	});
+	if (!found) {
+		if (m_cores) {
+			m_cores->Release(core);
+		}
+		m_logger << Logger::Level::LowLevel << "Client id=" << client_id.ToString()
+				<< " not found; ending communication thread" << std::endl;
+		return;
+	}
+	if (m_cores) {
+		// Everything this thread allocates from here on (frames, replies) stays on the core's node
+		m_cores->Enter(core);
+	}
+
+	// Owned by this thread, so frames are checked without locks
+	Connection::RateLimiter limiter(RateLimits());
+	// Staged: this thread only reads and checks frames, the stage decodes and handles them
+	const std::shared_ptr<Executor::Lane> lane = m_stage ? m_stage->Open() : nullptr;
+	// Hands sharded and routed requests to their thread / pool; the ticket lasts until the reply
+	const auto route = [this, client, client_id](PacketPointer packet, std::optional<Connection::Budget::Ticket>& ticket) {
+		if (m_shards) {
+			if (std::optional<std::uint64_t> key = ShardKey(client_id, packet)) {
+				bool submitted = m_shards->Submit(key.value(), [this, client, client_id, packet, ticket = std::move(ticket)] {
+					if (!HandleRequest(client, client_id, packet)) {
+						DisconnectClient(client_id);
+					}
+				}, [this, client] {
+					return Connection::IsConnected(m_status.load()) && Connection::IsConnected(client->Status());
+				});
+				if (!submitted) {
+					// Only gives up once the server or this client is closing; the dropped task frees the ticket
+					m_logger << Logger::Level::Warning << "Dropping request from closing client=" << client_id.ToString() << std::endl;
+					DisconnectClient(client_id);
+				}
+				return true;
+			}
+		}
+		auto handler_class = m_routes.find(packet->Opcode());
+		if (handler_class == m_routes.end()) {
+			return false;
+		}
+		m_dispatcher->Submit(handler_class->second, client_id.Value(), [this, client, client_id, packet, ticket = std::move(ticket)] {
+			if (!HandleRequest(client, client_id, packet)) {
+				DisconnectClient(client_id);
+			}
+		});
+		return true;
+	};
 	while (Connection::IsConnected(m_status.load()) && Connection::IsConnected(client->Status())) {
 		auto expected_wait = client->Socket()->WaitForData();
 		if (!expected_wait) {
@@ -205,32 +811,129 @@ void Server::HandleClientCommunication(const std::string& client_uuid) noexcept
 		switch (expected_wait.value()) {
 			case Connection::Read::Result::Success: {
 				PacketPointer packet;
+				std::optional<Connection::Budget::Ticket> ticket;
 				{
-					Transport::Frame frame = client->Receive(m_logger);
+					Transport::Frame frame = lane ? client->Read(m_logger) : client->Receive(m_logger);
+					if (frame.Opcode() == 0) {
+						// Failed read (empty frame): nothing to admit or stage
+						break;
+					}
+					if (stamp_activity) {
+						// Only a stamp: idle and heartbeat timers re-arm themselves lazily
+						client->Touch(Executor::TimerWheel::Instance().Now());
+					}
+					if (client->Status() == Connection::Status::Negotiating) {
+						// Opcode 1 is also a legacy application opcode: only a payload with the handshake magic is a Hello
+						if (Transport::IsControl(frame.Opcode(), Transport::Control::Hello) && Connection::Handshake::IsHandshake(frame.Payload())) {
+							if (!AcceptHandshake(client, frame)) {
+								break;
+							}
+							continue;
+						}
+						// First frame is not a handshake: client predates it
+						ApplyCapabilities(client, Connection::Capabilities::Legacy());
+					}
+					// Without the feature opcode 3 is a plain application packet
+					const bool batch = frame.IsBatch() && client->Capabilities().Has(Connection::Feature::Batch);
+					if (client->Capabilities().Has(Connection::Feature::Heartbeat)) {
+						// Never rate limited nor shed: they only prove the peer is alive
+						if (Transport::IsControl(frame.Opcode(), Transport::Control::Ping)) {
+							if (!Reply(client, Transport::Heartbeat::Pong(frame))) {
+								break;
+							}
+							continue;
+						}
+						if (Transport::IsControl(frame.Opcode(), Transport::Control::Pong)) {
+							auto expected_rtt = Transport::Heartbeat::RoundTrip(frame);
+							if (!expected_rtt) {
+								m_logger << Logger::Level::Error << expected_rtt.error()->what() << " from client=" << client_id.ToString() << std::endl;
+								break;
+							}
+							client->SampleRoundTrip(expected_rtt.value());
+							continue;
+						}
+					}
+					// Batched packets are counted one by one once split
+					if (limiter.Enabled() && !batch && !Throttle(limiter, client_id, frame.Opcode())) {
+						if (limiter.Action() == Connection::RateLimitAction::Reject && RefuseRequest(client, client_id)) {
+							continue;
+						}
+						break;
+					}
+					if (client->Capabilities().Has(Connection::Feature::PubSub)
+						&& (Transport::IsControl(frame.Opcode(), Transport::Control::Subscribe) || Transport::IsControl(frame.Opcode(), Transport::Control::Unsubscribe))) {
+						if (!ProcessSubscription(client, client_id, frame)) {
+							break;
+						}
+						continue;
+					}
+					// Shed before any decoding or application work
+					ticket = m_budget->AdmitRequest(frame.Payload().size());
+					if (!ticket) {
+						if (!RefuseRequest(client, client_id)) {
+							break;
+						}
+						continue;
+					}
+					if (batch && (!lane || limiter.Enabled())) {
+						// Split here so this thread's limiter counts every packet (decoding a staged batch early)
+						std::optional<std::vector<Transport::Frame>> frames;
+						if (!client->Decode(frame, m_logger) || !(frames = SplitBatch(client_id, frame))) {
+							break;
+						}
+						if (!ThrottleBatch(limiter, client_id, frames.value())) {
+							if (limiter.Action() == Connection::RateLimitAction::Reject && RefuseRequest(client, client_id)) {
+								continue;
+							}
+							break;
+						}
+						if (lane) {
+							bool enqueued = Enqueue(client, lane, [this, client, client_id, frames = std::move(frames.value()), ticket = std::move(ticket)] mutable {
+								if (!HandleBatch(client, client_id, frames)) {
+									DisconnectClient(client_id);
+								}
+							});
+							if (!enqueued) {
+								break;
+							}
+							continue;
+						}
+						if (!HandleBatch(client, client_id, frames.value())) {
+							break;
+						}
+						continue;
+					}
+					if (lane) {
+						bool enqueued = Enqueue(client, lane, [this, client, client_id, route, frame = std::move(frame), ticket = std::move(ticket)] mutable {
+							PacketPointer staged;
+							if (!DecodeRequest(client, client_id, frame, staged)) {
+								DisconnectClient(client_id);
+							}
+							else if (staged && !route(staged, ticket) && !HandleRequest(client, client_id, staged)) {
+								DisconnectClient(client_id);
+							}
+						});
+						if (!enqueued) {
+							break;
+						}
+						continue;
+					}
 					packet = frame.ProcessPacket(m_deserialize_packet_function, m_logger);
 				}
 				if (!packet) {
 					m_logger << Logger::Level::Error << "Failed to process packet from client="
-							<< client_uuid << std::endl;
+							<< client_id.ToString() << std::endl;
 					break;
 				}
 
-				if (!Connection::IsConnected(m_status.load())) {
-					break;
-				}
-
-				PacketPointer response_packet = ProcessClientPacket(client_uuid, packet);
-				if (!response_packet) {
-					m_logger << Logger::Level::Error
-							<< "HandleClientCommunication: response packet was null" << std::endl;
-					break;
+				if (route(packet, ticket)) {
+					// Handled by the class's pool while this thread reads on
+					continue;
 				}
 
-				if (client->Socket()->HasShutdownRequest() || !Connection::IsConnected(m_status.load())) {
+				if (!HandleRequest(client, client_id, packet)) {
 					break;
 				}
-
-				Reply(client, *response_packet);
 				continue; // success path: wait for next message
 			}
 
@@ -249,7 +952,10 @@ void Server::HandleClientCommunication(const std::string& client_uuid) noexcept
 		break; // Closed / error / null packet
 	}
 
-	DisconnectClient(client_uuid);
-	m_logger << Logger::Level::LowLevel << "Stopped communication thread for client uuid="
-			<< client_uuid << std::endl;
+	if (m_cores) {
+		m_cores->Release(core);
+	}
+	DisconnectClient(client_id);
+	m_logger << Logger::Level::LowLevel << "Stopped communication thread for client id="
+			<< client_id.ToString() << std::endl;
 }
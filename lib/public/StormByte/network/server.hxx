@@ -19,12 +19,26 @@
 
 #pragma once
 
+#include <StormByte/network/connection/admission.hxx>
+#include <StormByte/network/connection/dispatch.hxx>
+#include <StormByte/network/connection/heartbeat.hxx>
+#include <StormByte/network/connection/id.hxx>
+#include <StormByte/network/connection/rate_limit.hxx>
+#include <StormByte/network/connection/sharding.hxx>
+#include <StormByte/network/connection/slow_consumer.hxx>
+#include <StormByte/network/connection/staging.hxx>
+#include <StormByte/network/connection/subscriber_options.hxx>
+#include <StormByte/network/connection/thread_per_core.hxx>
 #include <StormByte/network/endpoint.hxx>
 
 #include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
 #include <mutex>
+#include <optional>
 #include <thread>
-#include <unordered_map>
+#include <vector>
 
 /**
  * @namespace StormByte::Network
@@ -32,20 +46,56 @@
  */
 namespace StormByte::Network {
 	namespace Connection {
-		class Client;	///< Forward declaration
+		class Budget;	///< Forward declaration
+		class Client;		///< Forward declaration
+		class RateLimiter;	///< Forward declaration
+		class Topics;		///< Forward declaration
+	}
+
+	namespace Executor {
+		class Cores;		///< Forward declaration
+		class Dispatcher;	///< Forward declaration
+		class Lane;			///< Forward declaration
+		class Shards;		///< Forward declaration
+		class Stage;		///< Forward declaration
 	}
 
 	namespace Socket {
 		class Server;	///< Forward declaration
 	}
 
+	namespace Transport {
+		class Frame;	///< Forward declaration
+	}
+
 	/**
 	 * @class Server
 	 * @brief Abstract application server endpoint.
 	 *
 	 * Manages listen socket, accept loop and per-client worker threads.
+	 * Clients are identified by a Connection::ID and kept in a sharded
+	 * registry, so lookups from worker threads and accepts / disconnects
+	 * only contend when they hit the same shard.
 	 * Implement @ref ProcessClientPacket() for application logic; override
-	 * pipelines as needed.
+	 * pipelines as needed. Packets of a batch frame are handled in order and
+	 * answered with one batch frame. @ref Broadcast() sends one packet to many
+	 * clients, serializing it once per distinct negotiated encoding.
+	 * Clients may subscribe to topics; @ref Publish() queues a packet for
+	 * every subscriber of a topic (see Connection::SubscriberOptions).
+	 * Clients whose send queue stops draining are handled by the
+	 * @ref SlowConsumers() policy, checked about once a second by the accept
+	 * thread. @ref Admission() limits shed load early: excess connections
+	 * are closed at accept and excess requests answered with a Busy frame.
+	 * @ref RateLimits() caps how fast each client may send frames.
+	 * @ref Dispatch() moves chosen opcodes off the client thread onto
+	 * prioritized handler pools (e.g. interactive vs bulk).
+	 * @ref Staging() leaves client threads only reading and checking
+	 * frames, while a bounded work-stealing stage pool decodes and handles
+	 * them. @ref ShardKey() sends all requests for one entity to the same
+	 * shard thread (see @ref Sharding()), so they run sequentially.
+	 * @ref ThreadPerCore() pins every connection to one core instead.
+	 * Clients silent for longer than @ref IdleTimeout() are disconnected;
+	 * @ref Heartbeat() pings clients and drops those that stop answering.
 	 *
 	 * @note **Inheritance-oriented.** Subclass required.
 	 */
@@ -105,36 +155,339 @@ namespace StormByte::Network {
 
 		protected:
 			/**
-			 * Disconnects a client by UUID.
-			 * @param uuid Client UUID.
+			 * Disconnects a client.
+			 * @param client_id Client ID.
+			 */
+			void DisconnectClient(const Connection::ID& client_id) noexcept;
+
+			/**
+			 * @param client_id Client ID.
+			 * @return UUID label of the client (generated on first use), or
+			 * an empty string if @p client_id is not connected.
+			 */
+			std::string ClientUUID(const Connection::ID& client_id) noexcept;
+
+			/**
+			 * Sends @p packet to every negotiated client accepted by @p filter.
+			 *
+			 * The packet is serialized once and each distinct encoding (frame
+			 * flags + compression) is built once into an immutable shared buffer
+			 * that all matching clients are sent from, so the cost no longer
+			 * grows with the client count. Frames are queued, never waited on.
+			 * @param packet Packet to send.
+			 * @param filter Recipient predicate (nullptr = all clients). It runs
+			 * under a registry lock, so it must not call back into the server.
+			 * @return Number of clients the packet was sent to (clients over
+			 * their send queue high watermark are skipped).
+			 */
+			std::size_t Broadcast(const Transport::Packet& packet, const std::function<bool(const Connection::ID&)>& filter = nullptr) noexcept;
+
+			/**
+			 * Queues @p packet for every subscriber of @p topic.
+			 *
+			 * The publication is encoded like @ref Broadcast() and pushed to each
+			 * subscriber's bounded queue, which the shared worker pool drains,
+			 * so this never waits on a subscriber socket.
+			 * @param topic Topic name.
+			 * @param packet Packet to publish.
+			 * @return Number of subscribers the publication was offered to.
+			 */
+			std::size_t Publish(const std::string& topic, const Transport::Packet& packet) noexcept;
+
+			/**
+			 * @return Queue options for new subscribers (default: SubscriberOptions defaults).
+			 */
+			virtual Connection::SubscriberOptions Subscriptions() const noexcept;
+
+			/**
+			 * Called when a client's outbound queue crosses its high watermark
+			 * (@p writable false) and when it drains to the low one (true), see
+			 * Connection::SendQueueOptions. Runs on a library thread and must
+			 * not disconnect the client. Default: does nothing.
+			 * @param client_id Client ID.
+			 * @param writable New state.
+			 */
+			virtual void ClientWritabilityChanged(const Connection::ID& client_id, const bool& writable) noexcept;
+
+			/**
+			 * @return Slow consumer limits applied to every accepted client
+			 * (default: SlowConsumerOptions defaults).
+			 */
+			virtual Connection::SlowConsumerOptions SlowConsumers() const noexcept;
+
+			/**
+			 * @param client_id Client ID.
+			 * @return Send-progress counters of the client, or std::nullopt if
+			 * @p client_id is not connected.
+			 */
+			std::optional<Connection::SendStats> ClientSendStats(const Connection::ID& client_id) noexcept;
+
+			/**
+			 * @return Number of clients disconnected by the slow consumer policy.
+			 */
+			std::uint64_t EvictedClients() const noexcept;
+
+			/**
+			 * @return Global limits, read once on @ref Connect() (default:
+			 * unlimited, see Connection::AdmissionOptions).
+			 */
+			virtual Connection::AdmissionOptions Admission() const noexcept;
+
+			/**
+			 * @return Current load and shedding counters.
+			 */
+			Connection::AdmissionStats Load() const noexcept;
+
+			/**
+			 * @return Per-connection frame rate limits, read when a client is
+			 * accepted (default: unlimited, see Connection::RateLimitOptions).
+			 */
+			virtual Connection::RateLimitOptions RateLimits() const noexcept;
+
+			/**
+			 * @return Number of received frames that were over a rate limit.
+			 */
+			std::uint64_t RateLimitedFrames() const noexcept;
+
+			/**
+			 * @return Handler classes and opcode routes, read once on
+			 * @ref Connect() (default: every request handled on its client's
+			 * thread, see Connection::DispatchOptions).
+			 */
+			virtual Connection::DispatchOptions Dispatch() const noexcept;
+
+			/**
+			 * @return Stage pool settings, read once on @ref Connect()
+			 * (default: off, see Connection::StagingOptions).
+			 */
+			virtual Connection::StagingOptions Staging() const noexcept;
+
+			/**
+			 * @return Stage scheduler counters (steals, queue depths), all
+			 * zero while staging is off.
+			 */
+			Connection::SchedulerStats SchedulerStats() const noexcept;
+
+			/**
+			 * @return Shard threads, read once on @ref Connect() (default: off,
+			 * see Connection::ShardingOptions).
+			 */
+			virtual Connection::ShardingOptions Sharding() const noexcept;
+
+			/**
+			 * Picks the shard of a decoded request. Runs on the thread that
+			 * decoded it, before any handler; shard keys take precedence over
+			 * @ref Dispatch() routes. Batches are not sharded.
+			 * @param client_id Sender ID.
+			 * @param packet Decoded request.
+			 * @return Shard key (e.g. the entity ID), or std::nullopt to handle
+			 * the request as if sharding were off (default).
+			 */
+			virtual std::optional<std::uint64_t> ShardKey(const Connection::ID& client_id, const PacketPointer& packet) const noexcept;
+
+			/**
+			 * @return Cores owning connections, read once on @ref Connect()
+			 * (default: off, see Connection::ThreadPerCoreOptions).
 			 */
-			void DisconnectClient(const std::string& uuid) noexcept;
+			virtual Connection::ThreadPerCoreOptions ThreadPerCore() const noexcept;
+
+			/**
+			 * @return Connections per core in thread-per-core mode (empty
+			 * otherwise), in ThreadPerCoreOptions::cpus order.
+			 */
+			std::vector<std::size_t> CoreConnections() const noexcept;
+
+			/**
+			 * @return Milliseconds a client may go without sending a frame
+			 * before it is disconnected, read when a client is accepted
+			 * (default: 0, never). Time spent in its handlers counts as idle.
+			 */
+			virtual unsigned int IdleTimeout() const noexcept;
+
+			/**
+			 * @return Number of clients disconnected for being idle.
+			 */
+			std::uint64_t IdleClients() const noexcept;
+
+			/**
+			 * @return Heartbeat settings, read when a client is accepted
+			 * (default: off, see Connection::HeartbeatOptions). Only clients
+			 * with Connection::Feature::Heartbeat are pinged. Time spent in
+			 * their handlers counts as silence.
+			 */
+			virtual Connection::HeartbeatOptions Heartbeat() const noexcept;
+
+			/**
+			 * @param client_id Client ID.
+			 * @return Heartbeat round-trip times of the client, or std::nullopt
+			 * if @p client_id is not connected.
+			 */
+			std::optional<Connection::RoundTripStats> ClientRoundTrip(const Connection::ID& client_id) noexcept;
+
+			/**
+			 * @return Number of clients disconnected for not answering heartbeats.
+			 */
+			std::uint64_t UnresponsiveClients() const noexcept;
 
 		private:
-			std::unique_ptr<Socket::Server> m_socket_server;											///< Listen socket
-			std::atomic<Connection::Status> m_status;												///< Server status
-			std::thread m_accept_thread;															///< Accept loop thread
-			std::unordered_map<std::string, std::shared_ptr<Connection::Client>> m_clients;		///< Active clients
-			std::unordered_map<std::string, std::thread> m_handle_msg_threads;						///< Per-client workers
-			std::mutex m_mutex;																		///< Protects client maps
+			struct ClientSlot;		///< Connection + worker thread (defined in server.cxx)
+			class ClientRegistry;	///< Thread-safe ClientSlot registry (defined in server.cxx)
+
+			std::unique_ptr<Socket::Server> m_socket_server;			///< Listen socket
+			std::atomic<Connection::Status> m_status;				///< Server status
+			std::thread m_accept_thread;							///< Accept loop thread
+			std::unique_ptr<ClientRegistry> m_clients;				///< Active clients and their workers
+			std::unique_ptr<Connection::Topics> m_topics;			///< Topic subscriptions
+			std::atomic<std::uint64_t> m_evicted;					///< Slow clients disconnected
+			std::shared_ptr<Connection::Budget> m_budget;			///< Admission limits and load
+			std::atomic<std::uint64_t> m_rate_limited;				///< Frames over a rate limit
+			std::unique_ptr<Executor::Dispatcher> m_dispatcher;		///< Handler pools (when routes are set)
+			std::unordered_map<Transport::Packet::OpcodeType, std::size_t> m_routes;	///< Opcode to handler class
+			std::unique_ptr<Executor::Stage> m_stage;				///< Decode / handler stage (when staging is on)
+			std::unique_ptr<Executor::Shards> m_shards;				///< Shard threads (when sharding is on)
+			std::unique_ptr<Executor::Cores> m_cores;				///< Connection to core assignment (thread-per-core mode)
+			std::atomic<std::uint64_t> m_idle;						///< Idle clients disconnected
+			std::atomic<std::uint64_t> m_unresponsive;				///< Clients disconnected by heartbeats
+			std::mutex m_retired_mutex;								///< Protects m_retired
+			std::vector<std::future<void>> m_retired;				///< Pending joins of disconnected clients' workers
 
 			/**
 			 * Accept-loop thread body.
 			 */
 			void AcceptClients() noexcept;
 
+			/**
+			 * Applies the @ref SlowConsumers() policy to every client: stalled
+			 * or overflowed clients have their fan-out frames dropped or are
+			 * disconnected.
+			 */
+			void EvictSlowConsumers() noexcept;
+
+			/**
+			 * Idle timer callback (runs on the timer wheel thread): closes the
+			 * client if it sent nothing for @p timeout, otherwise re-arms for
+			 * the rest of the window, so receiving a frame only stamps it.
+			 * @param client_id Client ID.
+			 * @param timeout Idle timeout.
+			 */
+			void CheckIdle(const Connection::ID& client_id, const std::chrono::milliseconds& timeout) noexcept;
+
+			/**
+			 * Heartbeat timer callback (runs on the timer wheel thread): closes
+			 * the client if it was silent for too long, otherwise queues a ping
+			 * on the shared pool and re-arms.
+			 * @param client_id Client ID.
+			 * @param options Heartbeat settings.
+			 */
+			void CheckHeartbeat(const Connection::ID& client_id, const Connection::HeartbeatOptions& options) noexcept;
+
 			/**
 			 * Per-client communication thread body.
-			 * @param client_uuid Client UUID.
+			 * @param client_id Client ID.
+			 */
+			void HandleClientCommunication(const Connection::ID& client_id) noexcept;
+
+			/**
+			 * Tells a client its request was shed.
+			 * @param client Client connection.
+			 * @param client_id Client ID.
+			 * @return false if the client must be disconnected (it does not
+			 * understand Busy replies, or the reply failed).
+			 */
+			bool RefuseRequest(std::shared_ptr<Connection::Client> client, const Connection::ID& client_id) noexcept;
+
+			/**
+			 * Runs the application handler for @p packet and replies.
+			 * @param client Client connection.
+			 * @param client_id Sender ID.
+			 * @param packet Decoded request.
+			 * @return false if the client must be disconnected (no response or
+			 * shutting down).
+			 */
+			bool HandleRequest(std::shared_ptr<Connection::Client> client, const Connection::ID& client_id, PacketPointer packet) noexcept;
+
+			/**
+			 * Hands a task to the stage, waiting (without reading) while the
+			 * client's lane is full.
+			 * @param client Client connection.
+			 * @param lane Client's stage lane.
+			 * @param task Task to run.
+			 * @return false if the client or server disconnected meanwhile.
+			 */
+			bool Enqueue(std::shared_ptr<Connection::Client> client, const std::shared_ptr<Executor::Lane>& lane, std::move_only_function<void()>&& task) noexcept;
+
+			/**
+			 * Stage side of a request: decodes @p frame and deserializes it.
+			 * Batches are handled right away.
+			 * @param client Client connection.
+			 * @param client_id Sender ID.
+			 * @param frame Frame as read from the socket.
+			 * @param packet Set to the decoded request (stays null for a batch).
+			 * @return false if the client must be disconnected.
+			 */
+			bool DecodeRequest(std::shared_ptr<Connection::Client> client, const Connection::ID& client_id, Transport::Frame& frame, PacketPointer& packet) noexcept;
+
+			/**
+			 * Applies the rate limits to one received frame (or batched packet),
+			 * sleeping first under RateLimitAction::Delay.
+			 * @param limiter Client's rate limiter.
+			 * @param client_id Client ID.
+			 * @param opcode Frame opcode.
+			 * @return true if the frame may be handled.
+			 */
+			bool Throttle(Connection::RateLimiter& limiter, const Connection::ID& client_id, const Transport::Packet::OpcodeType& opcode) noexcept;
+
+			/**
+			 * Answers a client handshake and applies its capabilities.
+			 * @param client Client connection (Negotiating).
+			 * @param hello Received Hello frame.
+			 * @return false on malformed handshake or send failure.
+			 */
+			bool AcceptHandshake(std::shared_ptr<Connection::Client> client, const Transport::Frame& hello) noexcept;
+
+			/**
+			 * Splits a decoded batch frame into its packets' frames.
+			 * @param client_id Sender ID.
+			 * @param batch Received batch frame.
+			 * @return Frames, or std::nullopt on a malformed batch.
+			 */
+			std::optional<std::vector<Transport::Frame>> SplitBatch(const Connection::ID& client_id, const Transport::Frame& batch) noexcept;
+
+			/**
+			 * Applies the rate limits to every packet of a batch (each counts
+			 * as a frame), all or nothing.
+			 * @param limiter Client's rate limiter.
+			 * @param client_id Client ID.
+			 * @param frames Batched frames.
+			 * @return true if the batch may be handled.
+			 */
+			bool ThrottleBatch(Connection::RateLimiter& limiter, const Connection::ID& client_id, const std::vector<Transport::Frame>& frames) noexcept;
+
+			/**
+			 * Handles every packet of a batch and replies with a batch of the
+			 * responses.
+			 * @param client Client connection.
+			 * @param client_id Sender ID.
+			 * @param frames Batched frames.
+			 * @return false on a failed packet or send failure.
+			 */
+			bool HandleBatch(std::shared_ptr<Connection::Client> client, const Connection::ID& client_id, std::vector<Transport::Frame>& frames) noexcept;
+
+			/**
+			 * Handles a subscribe / unsubscribe request and acknowledges it.
+			 * @param client Client connection.
+			 * @param client_id Sender ID.
+			 * @param request Received Subscribe / Unsubscribe frame (payload: topic).
+			 * @return false on an invalid topic or send failure.
 			 */
-			void HandleClientCommunication(const std::string& client_uuid) noexcept;
+			bool ProcessSubscription(std::shared_ptr<Connection::Client> client, const Connection::ID& client_id, const Transport::Frame& request) noexcept;
 
 			/**
 			 * Application packet handler.
-			 * @param client_uuid Sender UUID.
+			 * @param client_id Sender ID.
 			 * @param packet Received packet.
 			 * @return Response packet, or nullptr on error / no reply.
 			 */
-			virtual PacketPointer ProcessClientPacket(const std::string& client_uuid, PacketPointer packet) noexcept = 0;
+			virtual PacketPointer ProcessClientPacket(const Connection::ID& client_id, PacketPointer packet) noexcept = 0;
 	};
 }
@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <StormByte/network/visibility.h>
+
+#include <cstddef>
+
+/**
+ * @namespace Transport
+ * @brief Application-layer messages (Packet, Frame) and on-wire layout.
+ */
+namespace StormByte::Network::Transport {
+	/**
+	 * @struct BatchOptions
+	 * @brief Thresholds for packets posted with Client::Post().
+	 *
+	 * Posted packets accumulate in one batch frame until any limit is reached
+	 * (checked on every post) or the client flushes explicitly.
+	 */
+	struct STORMBYTE_NETWORK_PUBLIC BatchOptions {
+		std::size_t max_size = 64 * 1024;	///< Flush once packed packets reach this many bytes
+		std::size_t max_packets = 256;		///< Flush once this many packets are queued (0 = no limit)
+		unsigned int max_delay = 5;			///< Flush once the oldest queued packet is this many milliseconds old (0 = no limit)
+	};
+}
@@ -0,0 +1,110 @@
+#include <StormByte/network/transport/codec.hxx>
+#include <StormByte/network/transport/compression.hxx>
+
+#include <optional>
+
+using StormByte::Buffer::DataType;
+using StormByte::Buffer::ExternalReader;
+using StormByte::Buffer::ExternalWriter;
+using StormByte::Buffer::Pipeline;
+using StormByte::Network::Transport::Codec;
+using namespace StormByte::Network::Transport::Compression;
+
+namespace {
+	/**
+	 * Collects the whole stage input (blocks until EoF).
+	 * @return Input, or std::nullopt if the input failed before EoF.
+	 */
+	std::optional<DataType> ReadAll(ExternalReader& in) noexcept {
+		DataType data;
+		while (!in.EoF()) {
+			DataType part;
+			// Extract blocks until bytes arrive, so coming back empty-handed means a broken input
+			if (!in.Extract(std::max<std::size_t>(1, in.AvailableBytes()), part) || part.empty()) {
+				if (in.EoF())
+					break;
+				return std::nullopt;
+			}
+			data.insert(data.end(), std::make_move_iterator(part.begin()), std::make_move_iterator(part.end()));
+		}
+		return data;
+	}
+}
+
+bool StormByte::Network::Transport::Compression::IsAvailable(const Algorithm& algorithm) noexcept {
+	switch (algorithm) {
+		case Algorithm::None:
+			return true;
+		case Algorithm::LZ4:
+#ifdef STORMBYTE_NETWORK_LZ4
+			return true;
+#else
+			return false;
+#endif
+		case Algorithm::Zstd:
+#ifdef STORMBYTE_NETWORK_ZSTD
+			return true;
+#else
+			return false;
+#endif
+		default:
+			return false;
+	}
+}
+
+std::uint32_t StormByte::Network::Transport::Compression::DictionaryID(const DataType& dictionary) noexcept {
+	// FNV-1a
+	std::uint32_t hash = 2166136261u;
+	for (const auto& byte : dictionary) {
+		hash ^= static_cast<std::uint8_t>(byte);
+		hash *= 16777619u;
+	}
+	return hash != 0 ? hash : 1;
+}
+
+Pipeline::PipeFunction StormByte::Network::Transport::Compression::Compressor(const Algorithm& algorithm, const int& level) noexcept {
+	auto codec = std::make_shared<const Codec>(Options { .algorithm = algorithm, .level = level, .min_size = 0, .dictionaries = {} });
+	return [codec](ExternalReader& in, ExternalWriter& out, std::shared_ptr<Logger::Log> log) {
+		const std::optional<DataType> data = ReadAll(in);
+		if (!data) {
+			log << Logger::Level::Error << "Compressor: input failed before EoF" << std::endl;
+			out.SetError();
+			return;
+		}
+		if (!out.Write(codec->Compress(0, *data))) {
+			log << Logger::Level::Error << "Compressor: Write failed" << std::endl;
+			out.SetError();
+			return;
+		}
+		out.Close();
+	};
+}
+
+Pipeline::PipeFunction StormByte::Network::Transport::Compression::Decompressor(const std::size_t& max_size) noexcept {
+	auto codec = std::make_shared<const Codec>(Options {});
+	return [codec, max_size](ExternalReader& in, ExternalWriter& out, std::shared_ptr<Logger::Log> log) {
+		const std::optional<DataType> block = ReadAll(in);
+		if (!block) {
+			log << Logger::Level::Error << "Decompressor: input failed before EoF" << std::endl;
+			out.SetError();
+			return;
+		}
+		if (block->empty()) {
+			out.Close();
+			return;
+		}
+
+		auto expected_data = codec->Decompress(0, *block, max_size);
+		if (!expected_data) {
+			log << Logger::Level::Error << "Decompressor: " << expected_data.error()->what() << std::endl;
+			out.SetError();
+			return;
+		}
+		if (!out.Write(std::move(expected_data.value()))) {
+			log << Logger::Level::Error << "Decompressor: Write failed" << std::endl;
+			out.SetError();
+			return;
+		}
+		out.Close();
+	};
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <StormByte/buffer/pipeline.hxx>
+#include <StormByte/network/transport/packet.hxx>
+#include <StormByte/network/visibility.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+/**
+ * @namespace Compression
+ * @brief Built-in payload compression (LZ4 / Zstandard).
+ *
+ * Codecs are optional at build time; use @ref IsAvailable() to query them.
+ */
+namespace StormByte::Network::Transport::Compression {
+	/**
+	 * @enum Algorithm
+	 * @brief Compression algorithm (value is sent on the wire).
+	 */
+	enum class STORMBYTE_NETWORK_PUBLIC Algorithm: std::uint8_t {
+		None	= 0,	///< Stored uncompressed
+		LZ4		= 1,	///< LZ4 (lowest latency)
+		Zstd	= 2,	///< Zstandard (best ratio)
+	};
+
+	/**
+	 * Converts an Algorithm to a human-readable string.
+	 * @param algorithm Algorithm value.
+	 * @return "None", "LZ4", "Zstd", or "Unknown".
+	 */
+	constexpr STORMBYTE_NETWORK_PUBLIC std::string AlgorithmString(const Algorithm& algorithm) noexcept {
+		switch (algorithm) {
+			case Algorithm::None:	return "None";
+			case Algorithm::LZ4:	return "LZ4";
+			case Algorithm::Zstd:	return "Zstd";
+			default:				return "Unknown";
+		}
+	}
+
+	/**
+	 * @struct Options
+	 * @brief Endpoint compression settings.
+	 *
+	 * Dictionaries are raw content dictionaries (e.g. trained with
+	 * `zstd --train` on sample payloads) keyed by opcode; both peers must
+	 * configure the same bytes for an opcode. Each compressed block carries
+	 * the dictionary ID so a mismatch is detected instead of misdecoded.
+	 */
+	struct STORMBYTE_NETWORK_PUBLIC Options {
+		Algorithm algorithm = Algorithm::None;											///< Outbound algorithm
+		int level = 0;																	///< Zstd level / LZ4 acceleration (0 = codec default)
+		std::size_t min_size = 64;														///< Smaller payloads are sent uncompressed
+		std::unordered_map<Packet::OpcodeType, Buffer::DataType> dictionaries;			///< Per-opcode dictionaries
+	};
+
+	/**
+	 * Default largest block @ref Decompressor() expands (2 MiB).
+	 */
+	constexpr std::size_t DEFAULT_MAX_SIZE = 2 * 1024 * 1024;
+
+	/**
+	 * @param algorithm Algorithm to check.
+	 * @return true if the library was built with @p algorithm.
+	 */
+	STORMBYTE_NETWORK_PUBLIC bool IsAvailable(const Algorithm& algorithm) noexcept;
+
+	/**
+	 * Computes the identifier carried by blocks compressed with @p dictionary.
+	 * @param dictionary Dictionary bytes.
+	 * @return Non-zero identifier (0 is reserved for "no dictionary").
+	 */
+	STORMBYTE_NETWORK_PUBLIC std::uint32_t DictionaryID(const Buffer::DataType& dictionary) noexcept;
+
+	/**
+	 * Pipeline stage compressing its whole input as a single block.
+	 *
+	 * For applications that want compression at a specific point of their
+	 * own pipeline; endpoints normally use @ref Options instead.
+	 * @param algorithm Algorithm (falls back to stored blocks if unavailable).
+	 * @param level Zstd level / LZ4 acceleration (0 = codec default).
+	 * @return Pipe function for Buffer::Pipeline::AddPipe().
+	 */
+	STORMBYTE_NETWORK_PUBLIC Buffer::Pipeline::PipeFunction Compressor(const Algorithm& algorithm, const int& level = 0) noexcept;
+
+	/**
+	 * Pipeline stage reversing @ref Compressor().
+	 *
+	 * The block header states the original size, so blocks claiming more
+	 * than @p max_size fail the stage before anything is allocated.
+	 * @param max_size Largest decompressed block accepted.
+	 * @return Pipe function for Buffer::Pipeline::AddPipe().
+	 */
+	STORMBYTE_NETWORK_PUBLIC Buffer::Pipeline::PipeFunction Decompressor(const std::size_t& max_size = DEFAULT_MAX_SIZE) noexcept;
+}
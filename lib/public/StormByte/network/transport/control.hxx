@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <StormByte/network/transport/packet.hxx>
+
+/**
+ * @namespace Transport
+ * @brief Application-layer messages (Packet, Frame) and on-wire layout.
+ */
+namespace StormByte::Network::Transport {
+	/**
+	 * @enum Control
+	 * @brief Opcodes reserved for library control frames.
+	 *
+	 * All are below Packet::PROCESS_THRESHOLD, so control frames never run
+	 * through pipelines, except @ref Control::Batch and @ref Control::Publish
+	 * which carry application packets. They are only intercepted (and only
+	 * run through pipelines) while the related feature is negotiated on the
+	 * connection; otherwise they reach the application unchanged. @ref Control::Hello
+	 * is only taken as a handshake when its payload starts with the handshake
+	 * magic, so applications predating the handshake may keep using opcode 1.
+	 */
+	enum class STORMBYTE_NETWORK_PUBLIC Control: Packet::OpcodeType {
+		Hello		= 1,	///< Client capabilities (handshake)
+		HelloAck	= 2,	///< Server capabilities (handshake)
+		Batch		= 3,	///< Several packets packed in one frame
+		Subscribe	= 4,	///< Topic subscription (answered with the same opcode)
+		Unsubscribe	= 5,	///< Topic unsubscription (answered with the same opcode)
+		Publish		= 6,	///< Packet published to a subscribed topic
+		Busy		= 7,	///< Request not processed because the server is overloaded
+		Ping		= 8,	///< Heartbeat carrying the sender's clock
+		Pong		= 9,	///< Heartbeat echo (same payload as the Ping)
+	};
+
+	/**
+	 * @param opcode Opcode to compare.
+	 * @param control Control opcode.
+	 * @return true if @p opcode is @p control.
+	 */
+	constexpr STORMBYTE_NETWORK_PUBLIC bool IsControl(const Packet::OpcodeType& opcode, const Control& control) noexcept {
+		return opcode == static_cast<Packet::OpcodeType>(control);
+	}
+}
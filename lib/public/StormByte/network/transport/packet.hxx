@@ -41,6 +41,8 @@ namespace StormByte::Network::Transport {
 	 * non-negative enum values convertible to that range.
 	 */
 	class STORMBYTE_NETWORK_PUBLIC Packet {
+		friend class Frame;	///< Reads the payload without the opcode
+
 		public:
 			using OpcodeType = unsigned short;	///< Opcode storage type
 
@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2024-2026 David C. Manuelda (StormBytePP)
+ *
+ * This file is part of StormByte.
+ *
+ * StormByte is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * StormByte is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with StormByte. If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <StormByte/network/typedefs.hxx>
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+/**
+ * @namespace Transport
+ * @brief Application-layer messages (Packet, Frame) and on-wire layout.
+ */
+namespace StormByte::Network::Transport {
+	/**
+	 * @class TrivialPacket
+	 * @brief Packet whose payload is one fixed-layout, trivially copyable value.
+	 *
+	 * The payload is the object representation of @p T (sizeof(T) bytes),
+	 * copied with memcpy in little-endian byte order, so fixed-size messages
+	 * need no per-field serialization code. Arithmetic and enum payloads are
+	 * byte swapped on big-endian hosts; aggregates require a little-endian
+	 * host. Every constraint is checked at compile time.
+	 *
+	 * Use @ref Deserialize() from the DeserializePacketFunction to rebuild it.
+	 *
+	 * @tparam OPCODE Packet opcode (enum value or integer fitting in OpcodeType).
+	 * @tparam T Payload type.
+	 */
+	template <auto OPCODE, typename T>
+	class TrivialPacket: public Packet {
+		static_assert(std::is_trivially_copyable_v<T>, "TrivialPacket payload must be trivially copyable");
+		static_assert(std::is_standard_layout_v<T>, "TrivialPacket payload must have standard layout");
+		static_assert(!std::is_pointer_v<T> && !std::is_member_pointer_v<T>, "TrivialPacket payload must not be a pointer");
+		static_assert(std::endian::native == std::endian::little || std::is_arithmetic_v<T> || std::is_enum_v<T>,
+			"TrivialPacket aggregate payloads require a little-endian host");
+		static_assert(static_cast<std::uintmax_t>(OPCODE) <= std::numeric_limits<Packet::OpcodeType>::max(),
+			"TrivialPacket opcode does not fit in Packet::OpcodeType");
+
+		public:
+			static constexpr OpcodeType STATIC_OPCODE = static_cast<OpcodeType>(OPCODE);	///< Packet opcode
+			static constexpr std::size_t PAYLOAD_SIZE = sizeof(T);								///< Payload size on the wire
+
+			/**
+			 * @param value Payload value.
+			 */
+			constexpr TrivialPacket(const T& value = T{}) noexcept:
+			Packet(STATIC_OPCODE),
+			m_value(value) {}
+
+			/**
+			 * Copy constructor.
+			 */
+			TrivialPacket(const TrivialPacket& other) = default;
+
+			/**
+			 * Move constructor.
+			 */
+			TrivialPacket(TrivialPacket&& other) noexcept = default;
+
+			/**
+			 * Destructor.
+			 */
+			~TrivialPacket() noexcept override = default;
+
+			/**
+			 * Copy assignment.
+			 */
+			TrivialPacket& operator=(const TrivialPacket& other) = default;
+
+			/**
+			 * Move assignment.
+			 */
+			TrivialPacket& operator=(TrivialPacket&& other) noexcept = default;
+
+			/**
+			 * @return Payload value.
+			 */
+			inline const T& Value() const noexcept {
+				return m_value;
+			}
+
+			/**
+			 * @return Mutable payload value.
+			 */
+			inline T& Value() noexcept {
+				return m_value;
+			}
+
+			/**
+			 * Decodes a payload produced by this packet type.
+			 * @param data Payload bytes (opcode excluded).
+			 * @return Value, or PacketError if @p data is not @ref PAYLOAD_SIZE bytes.
+			 */
+			static Expected<T, PacketError> Decode(std::span<const std::byte> data) noexcept {
+				if (data.size() != PAYLOAD_SIZE)
+					return Unexpected<PacketError>("Trivial packet {} expects {} bytes, got {}", STATIC_OPCODE, PAYLOAD_SIZE, data.size());
+
+				T value;
+				if constexpr (std::endian::native == std::endian::little) {
+					std::memcpy(&value, data.data(), PAYLOAD_SIZE);
+				}
+				else {
+					std::byte swapped[PAYLOAD_SIZE];
+					std::reverse_copy(data.begin(), data.end(), swapped);
+					std::memcpy(&value, swapped, PAYLOAD_SIZE);
+				}
+				return value;
+			}
+
+			/**
+			 * Builds the packet from a received payload; fits a
+			 * DeserializePacketFunction case directly.
+			 * @param consumer Payload bytes.
+			 * @param logger Logger.
+			 * @return Packet, or nullptr on a payload of the wrong size.
+			 */
+			static PacketPointer Deserialize(Buffer::Consumer consumer, std::shared_ptr<Logger::Log> logger) noexcept {
+				Buffer::DataType data;
+				consumer.ExtractUntilEoF(data);
+
+				auto expected_value = Decode(data);
+				if (!expected_value) {
+					logger << Logger::Level::Error << expected_value.error()->what() << std::endl;
+					return nullptr;
+				}
+				return std::make_shared<TrivialPacket>(expected_value.value());
+			}
+
+		private:
+			T m_value;	///< Payload value
+
+			/**
+			 * @return Object representation of the value (little-endian).
+			 */
+			Buffer::DataType DoSerialize() const noexcept override {
+				Buffer::DataType data(PAYLOAD_SIZE);
+				std::memcpy(data.data(), &m_value, PAYLOAD_SIZE);
+				if constexpr (std::endian::native != std::endian::little)
+					std::reverse(data.begin(), data.end());
+				return data;
+			}
+	};
+}
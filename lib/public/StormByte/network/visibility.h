@@ -32,3 +32,9 @@
 	#define STORMBYTE_NETWORK_PUBLIC		__attribute__ ((visibility ("default")))
 	#define STORMBYTE_NETWORK_PRIVATE		__attribute__ ((visibility ("hidden")))
 #endif
+
+// Test builds export private classes too, so unit tests can reach them
+#ifdef STORMBYTE_NETWORK_TESTING
+	#undef STORMBYTE_NETWORK_PRIVATE
+	#define STORMBYTE_NETWORK_PRIVATE		STORMBYTE_NETWORK_PUBLIC
+#endif
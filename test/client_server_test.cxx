@@ -1,13 +1,31 @@
 #include <StormByte/network/client.hxx>
+#include <StormByte/network/client_pool.hxx>
+#include <StormByte/network/connection/resolver.hxx>
+#include <StormByte/network/connection/sharded_registry.hxx>
 #include <StormByte/network/server.hxx>
+#include <StormByte/network/socket/client.hxx>
+#include <StormByte/network/socket/server.hxx>
+#include <StormByte/network/transport/codec.hxx>
+#include <StormByte/network/transport/compression.hxx>
+#include <StormByte/network/transport/crc32c.hxx>
+#include <StormByte/network/transport/frame.hxx>
+#include <StormByte/network/transport/trivial_packet.hxx>
 #include <StormByte/serializable.hxx>
 #include <StormByte/logger/threaded_log.hxx>
 #include <StormByte/test_handlers.h>
 #include <StormByte/system.hxx>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cstdlib>
+#include <functional>
+#include <future>
 #include <iostream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <span>
 #include <thread>
 #include <random>
 #include <utility>
@@ -161,6 +179,25 @@ namespace Test {
 			private:
 				std::string m_data;
 		};
+
+		/**
+		 * @brief Text packet with an opcode below PROCESS_THRESHOLD, as used by
+		 * applications predating the reserved control opcodes.
+		 */
+		class LowOpcode: public Transport::Packet {
+			public:
+				LowOpcode(const Transport::Packet::OpcodeType& opcode, std::string text): Transport::Packet(opcode), m_text(std::move(text)) {}
+				DataType DoSerialize() const noexcept override {
+					return Serializable<std::string>(m_text).Serialize();
+				}
+
+				const std::string& GetText() const noexcept {
+					return m_text;
+				}
+
+			private:
+				std::string m_text;
+		};
 	}
 
 	DeserializePacketFunction DeserializeFunction() {
@@ -168,6 +205,13 @@ namespace Test {
 			(void)logger;
 			DataType data;
 			consumer.ExtractUntilEoF(data);
+			if (opcode < Transport::Packet::PROCESS_THRESHOLD) {
+				auto expected_text = Serializable<std::string>::Deserialize(data);
+				if (!expected_text) {
+					return nullptr;
+				}
+				return std::make_shared<Packet::LowOpcode>(opcode, std::move(*expected_text));
+			}
 			switch(static_cast<Packet::Opcode>(opcode)) {
 				case Packet::Opcode::C_MSG_ASKNAMELIST: {
 					auto expected_amount = Serializable<std::size_t>::Deserialize(data);
@@ -216,6 +260,7 @@ namespace Test {
 
 	using ExpectedNameList = NetExpected<std::vector<std::string>>;
 	using ExpectedRandomNumber = NetExpected<int>;
+	using ExpectedRandomNumbers = NetExpected<std::vector<int>>;
 	using ExpectedLargeData = NetExpected<std::string>;
 
 	/**
@@ -271,6 +316,8 @@ namespace Test {
 			Net::Client(DeserializeFunction(), logger) {}
 			~Client() noexcept = default;
 
+			using Net::Client::ServerBusy;
+
 			Pipeline InputPipeline() const noexcept override {
 				Pipeline pipeline;
 				pipeline.AddPipe(CreateXorPipe());
@@ -310,6 +357,24 @@ namespace Test {
 				return answer_packet->GetNumber();
 			}
 
+			ExpectedRandomNumbers RequestRandomNumbers(const std::size_t& amount) noexcept {
+				for (std::size_t i = 0; i < amount; ++i) {
+					if (!Post(Packet::AskRandomNumber())) {
+						return SB::Unexpected<Net::Exception>("Client::RequestRandomNumbers: failed to post AskRandomNumber packet {}", i);
+					}
+				}
+
+				std::vector<int> numbers;
+				for (const auto& response_packet : Flush()) {
+					std::shared_ptr<Packet::AnswerRandomNumber> answer_packet = std::dynamic_pointer_cast<Packet::AnswerRandomNumber>(response_packet);
+					if (!answer_packet) {
+						return SB::Unexpected<Net::Exception>("Client::RequestRandomNumbers: received unexpected packet opcode ({})", response_packet->Opcode());
+					}
+					numbers.push_back(answer_packet->GetNumber());
+				}
+				return numbers;
+			}
+
 			ExpectedLargeData RequestLargeDataEcho(const std::size_t& size) noexcept {
 				Packet::LargeData request_packet(size);
 				auto response_packet = Send(request_packet);
@@ -324,6 +389,34 @@ namespace Test {
 				// Move data out of the packet so the shared_ptr can die without retaining 20 MiB
 				return answer_packet->TakeData();
 			}
+
+			ExpectedLargeData RequestDataEcho(std::string data) noexcept {
+				Packet::LargeData request_packet(std::move(data));
+				auto response_packet = Send(request_packet);
+				if (!response_packet) {
+					return SB::Unexpected<Net::Exception>("Client::RequestDataEcho: failed to send LargeData packet");
+				}
+
+				std::shared_ptr<Packet::AnswerLargeDataEchoed> answer_packet = std::dynamic_pointer_cast<Packet::AnswerLargeDataEchoed>(response_packet);
+				if (!answer_packet) {
+					return SB::Unexpected<Net::Exception>("Client::RequestDataEcho: received unexpected packet opcode ({})", response_packet->Opcode());
+				}
+				return answer_packet->TakeData();
+			}
+
+			ExpectedLargeData RequestLowOpcodeEcho(const Transport::Packet::OpcodeType& opcode, const std::string& text) noexcept {
+				Packet::LowOpcode request_packet(opcode, text);
+				auto response_packet = Send(request_packet);
+				if (!response_packet) {
+					return SB::Unexpected<Net::Exception>("Client::RequestLowOpcodeEcho: failed to send opcode {} packet", opcode);
+				}
+
+				std::shared_ptr<Packet::LowOpcode> answer_packet = std::dynamic_pointer_cast<Packet::LowOpcode>(response_packet);
+				if (!answer_packet || answer_packet->Opcode() != opcode) {
+					return SB::Unexpected<Net::Exception>("Client::RequestLowOpcodeEcho: received unexpected packet opcode ({})", response_packet->Opcode());
+				}
+				return answer_packet->GetText();
+			}
 	};
 
 	class Server: public Net::Server {
@@ -343,9 +436,12 @@ namespace Test {
 				return pipeline;
 			}
 
-		private:
-			PacketPointer ProcessClientPacket(const std::string& client_uuid, PacketPointer packet) noexcept override {
-				(void)client_uuid;
+		protected:
+			PacketPointer ProcessClientPacket(const Net::Connection::ID& client_id, PacketPointer packet) noexcept override {
+				(void)client_id;
+				if (auto low_packet = std::dynamic_pointer_cast<Packet::LowOpcode>(packet)) {
+					return std::make_shared<Packet::LowOpcode>(low_packet->Opcode(), low_packet->GetText());
+				}
 				switch(static_cast<Packet::Opcode>(packet->Opcode())) {
 					case Packet::Opcode::C_MSG_ASKNAMELIST: {
 						auto ask_packet = std::dynamic_pointer_cast<Packet::AskNameList>(packet);
@@ -384,6 +480,394 @@ namespace Test {
 				return {};
 			}
 	};
+
+	/**
+	 * @brief Connected socket pair for frame level tests.
+	 * @return (connecting side, accepted side), or nullptrs on failure.
+	 */
+	std::pair<std::shared_ptr<Net::Socket::Client>, std::shared_ptr<Net::Socket::Client>> SocketPair(Net::Socket::Server& listener) noexcept {
+		if (!listener.Listen(HOST, PORT))
+			return {};
+		auto sender = std::make_shared<Net::Socket::Client>(Net::Connection::Protocol::IPv4, logger);
+		if (!sender->Connect(HOST, PORT))
+			return {};
+		auto expected_receiver = listener.Accept();
+		if (!expected_receiver)
+			return {};
+		return { sender, expected_receiver.value() };
+	}
+
+	/**
+	 * @brief Compression settings for the compressed client/server pair.
+	 *
+	 * Prefers Zstd, then LZ4 (plain frames if neither is built); the name list
+	 * reply gets a dictionary so the dictionary path is exercised too. The
+	 * pair also negotiates capabilities with the handshake.
+	 */
+	Transport::Compression::Options MakeCompressionOptions() noexcept {
+		using Transport::Compression::Algorithm;
+		Transport::Compression::Options options;
+		if (Transport::Compression::IsAvailable(Algorithm::Zstd))
+			options.algorithm = Algorithm::Zstd;
+		else if (Transport::Compression::IsAvailable(Algorithm::LZ4))
+			options.algorithm = Algorithm::LZ4;
+		options.min_size = 16;
+
+		std::string dictionary;
+		for (std::size_t i = 0; i < 64; ++i)
+			dictionary += "Name_" + std::to_string(i + 1);
+		const auto* bytes = reinterpret_cast<const std::byte*>(dictionary.data());
+		options.dictionaries[static_cast<Transport::Packet::OpcodeType>(Packet::Opcode::S_MSG_RESPONDNAMELIST)] = DataType(bytes, bytes + dictionary.size());
+		return options;
+	}
+
+	class CompressedClient: public Client {
+		public:
+			using Client::Client;
+
+			Transport::Compression::Options CompressionOptions() const noexcept override {
+				return MakeCompressionOptions();
+			}
+
+			Net::Connection::HandshakeOptions Handshake() const noexcept override {
+				return { .enabled = true, .timeout = 2, .max_frame_size = 0 };
+			}
+
+			bool FrameChecksum() const noexcept override {
+				return true;
+			}
+	};
+
+	class CompressedServer: public Server {
+		public:
+			using Server::Server;
+
+			Transport::Compression::Options CompressionOptions() const noexcept override {
+				return MakeCompressionOptions();
+			}
+
+			Net::Connection::HandshakeOptions Handshake() const noexcept override {
+				return { .enabled = true, .timeout = 2, .max_frame_size = 0 };
+			}
+
+			bool FrameChecksum() const noexcept override {
+				return true;
+			}
+	};
+
+	/**
+	 * @brief Client/server pair performing the capability handshake, so frame
+	 * flags and optional protocol features are in use (no compression).
+	 */
+	class NegotiatingClient: public Client {
+		public:
+			using Client::Client;
+
+			Net::Connection::HandshakeOptions Handshake() const noexcept override {
+				return { .enabled = true, .timeout = 2, .max_frame_size = 0 };
+			}
+	};
+
+	class NegotiatingServer: public Server {
+		public:
+			using Server::Server;
+
+			Net::Connection::HandshakeOptions Handshake() const noexcept override {
+				return { .enabled = true, .timeout = 2, .max_frame_size = 0 };
+			}
+	};
+
+	class ImpatientClient: public Client {
+		public:
+			using Client::Client;
+
+		private:
+			unsigned int RequestTimeout() const noexcept override {
+				return 150;
+			}
+	};
+
+	class HastyDialClient: public Client {
+		public:
+			using Client::Client;
+
+		private:
+			Net::Connection::DialOptions Dialing() const noexcept override {
+				return { 300, 50 };
+			}
+	};
+
+	class HeartbeatClient: public NegotiatingClient {
+		public:
+			using NegotiatingClient::NegotiatingClient;
+			using Client::Ping;
+			using Client::Poll;
+	};
+
+	class SubscribingClient: public NegotiatingClient {
+		public:
+			using NegotiatingClient::NegotiatingClient;
+			using Client::Subscribe;
+			using Client::Unsubscribe;
+			using Client::Poll;
+
+			std::vector<std::pair<std::string, int>> published;
+			std::size_t received = 0;
+
+		private:
+			void ProcessPublishedPacket(const std::string& topic, PacketPointer packet) noexcept override {
+				++received;
+				auto number_packet = std::dynamic_pointer_cast<Packet::AnswerRandomNumber>(packet);
+				if (number_packet)
+					published.emplace_back(topic, number_packet->GetNumber());
+			}
+	};
+
+	class BackpressureServer: public NegotiatingServer {
+		public:
+			using NegotiatingServer::NegotiatingServer;
+
+			std::atomic<int> paused { 0 };
+			std::atomic<int> resumed { 0 };
+
+			Net::Connection::SendQueueOptions SendQueue() const noexcept override {
+				return { .high_watermark = 256 * 1024, .low_watermark = 64 * 1024 };
+			}
+
+			std::size_t PublishData(const std::string& topic, const std::size_t& size) noexcept {
+				return Publish(topic, Packet::LargeData(size));
+			}
+
+		private:
+			void ClientWritabilityChanged(const Net::Connection::ID&, const bool& writable) noexcept override {
+				(writable ? resumed : paused)++;
+			}
+	};
+
+	class BroadcastingServer: public BackpressureServer {
+		public:
+			using BackpressureServer::BackpressureServer;
+
+			std::mutex clients_mutex;
+			std::vector<Net::Connection::ID> clients;	///< In order of their first request
+
+			std::size_t BroadcastNumber(const int& number, const std::function<bool(const Net::Connection::ID&)>& filter) noexcept {
+				return Broadcast(Packet::AnswerRandomNumber(number), filter);
+			}
+
+		private:
+			PacketPointer ProcessClientPacket(const Net::Connection::ID& client_id, PacketPointer packet) noexcept override {
+				{
+					std::scoped_lock lock(clients_mutex);
+					if (std::find(clients.begin(), clients.end(), client_id) == clients.end())
+						clients.push_back(client_id);
+				}
+				return BackpressureServer::ProcessClientPacket(client_id, packet);
+			}
+	};
+
+	class SlowConsumerServer: public BackpressureServer {
+		public:
+			using BackpressureServer::BackpressureServer;
+			using BackpressureServer::EvictedClients;
+
+			Net::Connection::SlowConsumerOptions SlowConsumers() const noexcept override {
+				return { .policy = Net::Connection::SlowConsumerPolicy::Disconnect, .max_queued_bytes = 0, .max_stall = 200 };
+			}
+	};
+
+	class AdmissionServer: public NegotiatingServer {
+		public:
+			using NegotiatingServer::NegotiatingServer;
+			using Server::Load;
+
+			Net::Connection::AdmissionOptions Admission() const noexcept override {
+				return { .max_connections = 2, .max_requests = 1, .max_buffered_bytes = 0 };
+			}
+
+		private:
+			PacketPointer ProcessClientPacket(const Net::Connection::ID& client_id, PacketPointer packet) noexcept override {
+				// Name lists are slow, so a concurrent request exceeds max_requests
+				if (static_cast<Packet::Opcode>(packet->Opcode()) == Packet::Opcode::C_MSG_ASKNAMELIST)
+					std::this_thread::sleep_for(std::chrono::milliseconds(500));
+				return Server::ProcessClientPacket(client_id, packet);
+			}
+	};
+
+	class RateLimitedServer: public NegotiatingServer {
+		public:
+			using NegotiatingServer::NegotiatingServer;
+			using Server::RateLimitedFrames;
+
+			Net::Connection::RateLimitOptions RateLimits() const noexcept override {
+				Net::Connection::RateLimitOptions options;
+				options.action = Net::Connection::RateLimitAction::Reject;
+				options.opcodes[static_cast<Transport::Packet::OpcodeType>(Packet::Opcode::C_MSG_ASKRANDOMNUMBER)] = { .rate = 1, .burst = 2 };
+				return options;
+			}
+	};
+
+	class DispatchingServer: public Server {
+		public:
+			using Server::Server;
+
+			std::atomic<int> bulk_running { 0 };
+			std::atomic<int> bulk_peak { 0 };
+
+			Net::Connection::DispatchOptions Dispatch() const noexcept override {
+				Net::Connection::DispatchOptions options;
+				options.classes = {
+					{ .name = "interactive", .threads = 1, .priority = 1, .ordered = false },
+					{ .name = "bulk", .threads = 1, .priority = 0, .ordered = true },
+				};
+				options.routes[static_cast<Transport::Packet::OpcodeType>(Packet::Opcode::C_MSG_ASKRANDOMNUMBER)] = 0;
+				options.routes[static_cast<Transport::Packet::OpcodeType>(Packet::Opcode::C_MSG_ASKNAMELIST)] = 1;
+				return options;
+			}
+
+		private:
+			PacketPointer ProcessClientPacket(const Net::Connection::ID& client_id, PacketPointer packet) noexcept override {
+				if (static_cast<Packet::Opcode>(packet->Opcode()) != Packet::Opcode::C_MSG_ASKNAMELIST)
+					return Server::ProcessClientPacket(client_id, packet);
+
+				const int running = ++bulk_running;
+				int peak = bulk_peak.load();
+				while (running > peak && !bulk_peak.compare_exchange_weak(peak, running)) {}
+				std::this_thread::sleep_for(std::chrono::milliseconds(300));
+				--bulk_running;
+				return Server::ProcessClientPacket(client_id, packet);
+			}
+	};
+
+	class StagedServer: public Server {
+		public:
+			using Server::Server;
+			using Server::SchedulerStats;
+
+			std::mutex threads_mutex;
+			std::set<std::thread::id> handler_threads;
+
+			Net::Connection::StagingOptions Staging() const noexcept override {
+				return { .workers = 2, .queue_capacity = 8, .lane_capacity = 4, .cpus = { 0 } };
+			}
+
+		private:
+			PacketPointer ProcessClientPacket(const Net::Connection::ID& client_id, PacketPointer packet) noexcept override {
+				{
+					std::scoped_lock lock(threads_mutex);
+					handler_threads.insert(std::this_thread::get_id());
+				}
+				// CPU-heavy handler: stage threads are busy while client threads keep reading
+				if (static_cast<Packet::Opcode>(packet->Opcode()) == Packet::Opcode::C_MSG_ASKNAMELIST)
+					std::this_thread::sleep_for(std::chrono::milliseconds(100));
+				return Server::ProcessClientPacket(client_id, packet);
+			}
+	};
+
+	class ShardedServer: public Server {
+		public:
+			using Server::Server;
+
+			std::mutex shards_mutex;
+			std::map<std::size_t, std::set<std::thread::id>> key_threads;
+			std::atomic<int> running[3] {};
+			std::atomic<int> key_peak { 0 };
+			std::atomic<int> total_running { 0 };
+			std::atomic<int> total_peak { 0 };
+
+			Net::Connection::ShardingOptions Sharding() const noexcept override {
+				return { .shards = 2, .queue_capacity = 16, .cpus = {} };
+			}
+
+			// Name lists are keyed by their size, standing in for an entity ID
+			std::optional<std::uint64_t> ShardKey(const Net::Connection::ID&, const PacketPointer& packet) const noexcept override {
+				auto ask_packet = std::dynamic_pointer_cast<Packet::AskNameList>(packet);
+				if (!ask_packet)
+					return std::nullopt;
+				return ask_packet->GetAmount();
+			}
+
+		private:
+			static void Raise(std::atomic<int>& peak, const int& value) noexcept {
+				int current = peak.load();
+				while (value > current && !peak.compare_exchange_weak(current, value)) {}
+			}
+
+			PacketPointer ProcessClientPacket(const Net::Connection::ID& client_id, PacketPointer packet) noexcept override {
+				auto ask_packet = std::dynamic_pointer_cast<Packet::AskNameList>(packet);
+				if (!ask_packet)
+					return Server::ProcessClientPacket(client_id, packet);
+
+				const std::size_t key = ask_packet->GetAmount();
+				{
+					std::scoped_lock lock(shards_mutex);
+					key_threads[key].insert(std::this_thread::get_id());
+				}
+				Raise(key_peak, ++running[key]);
+				Raise(total_peak, ++total_running);
+				std::this_thread::sleep_for(std::chrono::milliseconds(20));
+				--total_running;
+				--running[key];
+				return Server::ProcessClientPacket(client_id, packet);
+			}
+	};
+
+	class ThreadPerCoreServer: public Server {
+		public:
+			using Server::Server;
+			using Server::CoreConnections;
+
+			// Two cores sharing the sandbox's first CPU
+			Net::Connection::ThreadPerCoreOptions ThreadPerCore() const noexcept override {
+				return { .cpus = { 0, 0 }, .local_memory = true };
+			}
+	};
+
+	class IdleTimeoutServer: public Server {
+		public:
+			using Server::Server;
+			using Server::IdleClients;
+
+			unsigned int IdleTimeout() const noexcept override {
+				return 300;
+			}
+
+		private:
+			PacketPointer ProcessClientPacket(const Net::Connection::ID& client_id, PacketPointer packet) noexcept override {
+				// Slow enough to outlast ImpatientClient's request timeout
+				if (static_cast<Packet::Opcode>(packet->Opcode()) == Packet::Opcode::C_MSG_ASKNAMELIST)
+					std::this_thread::sleep_for(std::chrono::milliseconds(400));
+				return Server::ProcessClientPacket(client_id, packet);
+			}
+	};
+
+	class HeartbeatServer: public NegotiatingServer {
+		public:
+			using NegotiatingServer::NegotiatingServer;
+			using Server::ClientRoundTrip;
+			using Server::UnresponsiveClients;
+
+			std::atomic<std::uint64_t> last_client { 0 };
+
+			Net::Connection::HeartbeatOptions Heartbeat() const noexcept override {
+				return { .interval = 100, .max_missed = 3 };
+			}
+
+		private:
+			PacketPointer ProcessClientPacket(const Net::Connection::ID& client_id, PacketPointer packet) noexcept override {
+				last_client = client_id.Value();
+				return Server::ProcessClientPacket(client_id, packet);
+			}
+	};
+
+	class PublishingServer: public NegotiatingServer {
+		public:
+			using NegotiatingServer::NegotiatingServer;
+
+			std::size_t PublishNumber(const std::string& topic, const int& number) noexcept {
+				return Publish(topic, Packet::AnswerRandomNumber(number));
+			}
+	};
 }
 
 int TestRequestNameList() {
@@ -488,11 +972,1094 @@ int TestRequestLargeDataEchoed() {
 	RETURN_TEST(fn_name, 0);
 }
 
+int TestTrivialPacket() {
+	const std::string fn_name = "TestTrivialPacket";
+
+	struct Position {
+		std::int32_t x;
+		std::int32_t y;
+		double heading;
+	};
+	using PositionPacket = Transport::TrivialPacket<Test::Packet::Opcode::S_MSG_RESPONDRANDOMNUMBER, Position>;
+
+	PositionPacket packet({ .x = -7, .y = 42, .heading = 1.5 });
+	DataType wire;
+	packet.Serialize().Read(0, wire);
+	ASSERT_EQUAL(fn_name, wire.size(), sizeof(Transport::Packet::OpcodeType) + sizeof(Position));
+
+	auto expected_position = PositionPacket::Decode(std::span<const std::byte>(wire).subspan(sizeof(Transport::Packet::OpcodeType)));
+	if (!expected_position) {
+		logger << Level::Error << fn_name << ": Decode failed: " << expected_position.error()->what() << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+	ASSERT_EQUAL(fn_name, expected_position->x, -7);
+	ASSERT_EQUAL(fn_name, expected_position->y, 42);
+	ASSERT_TRUE(fn_name, expected_position->heading == 1.5);
+
+	// Truncated payloads are rejected
+	ASSERT_TRUE(fn_name, !PositionPacket::Decode(std::span<const std::byte>(wire).subspan(3)));
+	RETURN_TEST(fn_name, 0);
+}
+
+int TestBatchedRequests() {
+	const std::string fn_name = "TestBatchedRequests";
+
+	Test::NegotiatingServer server(logger);
+	if (!server.Connect(Net::Connection::Protocol::IPv4, HOST, PORT)) {
+		logger << Level::Error << fn_name << ": server.Connect failed." << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+	Test::NegotiatingClient client(logger);
+	if (!client.Connect(Net::Connection::Protocol::IPv4, HOST, PORT)) {
+		logger << Level::Error << fn_name << ": client.Connect failed." << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+
+	// More than one batch worth of packets (default limit is 256)
+	const std::size_t amount = 300;
+	auto numbers_expected = client.RequestRandomNumbers(amount);
+	if (!numbers_expected) {
+		logger << Level::Error << fn_name << ": RequestRandomNumbers failed: " << numbers_expected.error()->what() << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+	ASSERT_EQUAL(fn_name, numbers_expected->size(), amount);
+	for (const int& n : numbers_expected.value()) {
+		ASSERT_TRUE(fn_name, n >= 0 && n < 100);
+	}
+
+	// Plain requests still work after batches
+	auto names_expected = client.RequestNameList(3);
+	if (!names_expected) {
+		logger << Level::Error << fn_name << ": RequestNameList failed: " << names_expected.error()->what() << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+	ASSERT_EQUAL(fn_name, names_expected->size(), std::size_t(3));
+
+	client.Disconnect();
+	server.Disconnect();
+	RETURN_TEST(fn_name, 0);
+}
+
+int TestSendQueueBackpressure() {
+	const std::string fn_name = "TestSendQueueBackpressure";
+
+	Test::BackpressureServer server(logger);
+	if (!server.Connect(Net::Connection::Protocol::IPv4, HOST, PORT)) {
+		logger << Level::Error << fn_name << ": server.Connect failed." << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+	Test::SubscribingClient client(logger);
+	if (!client.Connect(Net::Connection::Protocol::IPv4, HOST, PORT)) {
+		logger << Level::Error << fn_name << ": client.Connect failed." << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+	ASSERT_TRUE(fn_name, client.Subscribe("bulk"));
+
+	// Far more than the socket buffers hold while the client is not reading
+	const std::size_t count = 32;
+	for (std::size_t i = 0; i < count; ++i)
+		ASSERT_EQUAL(fn_name, server.PublishData("bulk", 512 * 1024), std::size_t(1));
+	for (int i = 0; i < 200 && server.paused.load() == 0; ++i)
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	ASSERT_TRUE(fn_name, server.paused.load() >= 1);
+
+	while (client.received < count && client.Poll(2000) > 0) {}
+	ASSERT_EQUAL(fn_name, client.received, count);
+
+	// The resume is reported right after the last write, possibly after the client read it
+	for (int i = 0; i < 100 && server.resumed.load() < server.paused.load(); ++i)
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	ASSERT_EQUAL(fn_name, server.resumed.load(), server.paused.load());
+
+	client.Disconnect();
+	server.Disconnect();
+	RETURN_TEST(fn_name, 0);
+}
+
+int TestBroadcast() {
+	const std::string fn_name = "TestBroadcast";
+
+	Test::BroadcastingServer server(logger);
+	if (!server.Connect(Net::Connection::Protocol::IPv4, HOST, PORT)) {
+		logger << Level::Error << fn_name << ": server.Connect failed." << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+	// The last client stops reading and backs up
+	std::vector<std::unique_ptr<Test::SubscribingClient>> clients;
+	for (int i = 0; i < 4; ++i) {
+		clients.push_back(std::make_unique<Test::SubscribingClient>(logger));
+		ASSERT_TRUE(fn_name, clients.back()->Connect(Net::Connection::Protocol::IPv4, HOST, PORT));
+		ASSERT_TRUE(fn_name, clients.back()->RequestRandomNumber().has_value());
+	}
+	std::vector<Net::Connection::ID> ids;
+	{
+		std::scoped_lock lock(server.clients_mutex);
+		ids = server.clients;
+	}
+	ASSERT_EQUAL(fn_name, ids.size(), clients.size());
+
+	Test::SubscribingClient& backed_up = *clients.back();
+	ASSERT_TRUE(fn_name, backed_up.Subscribe("bulk"));
+	const std::size_t count = 32;
+	for (std::size_t i = 0; i < count; ++i)
+		ASSERT_EQUAL(fn_name, server.PublishData("bulk", 512 * 1024), std::size_t(1));
+	for (int i = 0; i < 200 && server.paused.load() == 0; ++i)
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	ASSERT_TRUE(fn_name, server.paused.load() >= 1);
+
+	// Outside the random number range, so it cannot be mistaken for a real reply
+	constexpr int broadcast_number = 1000;
+	const Net::Connection::ID excluded = ids[1];
+	const std::size_t sent = server.BroadcastNumber(broadcast_number, [&excluded](const Net::Connection::ID& id) {
+		return id != excluded;
+	});
+	ASSERT_EQUAL(fn_name, sent, std::size_t(2));
+
+	// Clients read the unsolicited frame as the reply to their next request
+	for (const std::size_t i : { std::size_t(0), std::size_t(2) }) {
+		auto number_expected = clients[i]->RequestRandomNumber();
+		ASSERT_TRUE(fn_name, number_expected.has_value());
+		ASSERT_EQUAL(fn_name, number_expected.value(), broadcast_number);
+	}
+	auto excluded_expected = clients[1]->RequestRandomNumber();
+	ASSERT_TRUE(fn_name, excluded_expected.has_value());
+	ASSERT_TRUE(fn_name, excluded_expected.value() >= 0 && excluded_expected.value() < 100);
+
+	// A queued broadcast frame would stop polling before every publication arrived
+	while (backed_up.received < count && backed_up.Poll(2000) > 0) {}
+	ASSERT_EQUAL(fn_name, backed_up.received, count);
+
+	for (auto& client : clients)
+		client->Disconnect();
+	server.Disconnect();
+	RETURN_TEST(fn_name, 0);
+}
+
+int TestSlowConsumerEviction() {
+	const std::string fn_name = "TestSlowConsumerEviction";
+
+	Test::SlowConsumerServer server(logger);
+	if (!server.Connect(Net::Connection::Protocol::IPv4, HOST, PORT)) {
+		logger << Level::Error << fn_name << ": server.Connect failed." << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+	Test::SubscribingClient client(logger);
+	if (!client.Connect(Net::Connection::Protocol::IPv4, HOST, PORT)) {
+		logger << Level::Error << fn_name << ": client.Connect failed." << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+	ASSERT_TRUE(fn_name, client.Subscribe("bulk"));
+
+	// The client never reads, so its queue stalls and the accept thread's sweep evicts it
+	for (std::size_t i = 0; i < 32; ++i)
+		server.PublishData("bulk", 512 * 1024);
+	for (int i = 0; i < 400 && server.EvictedClients() == 0; ++i)
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	ASSERT_EQUAL(fn_name, server.EvictedClients(), std::uint64_t(1));
+
+	// Publications to the evicted client go nowhere
+	ASSERT_EQUAL(fn_name, server.PublishData("bulk", 1024), std::size_t(0));
+
+	client.Disconnect();
+	server.Disconnect();
+	RETURN_TEST(fn_name, 0);
+}
+
+int TestAdmissionControl() {
+	const std::string fn_name = "TestAdmissionControl";
+
+	Test::AdmissionServer server(logger);
+	if (!server.Connect(Net::Connection::Protocol::IPv4, HOST, PORT)) {
+		logger << Level::Error << fn_name << ": server.Connect failed." << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+	Test::NegotiatingClient slow(logger), busy(logger), rejected(logger);
+	ASSERT_TRUE(fn_name, slow.Connect(Net::Connection::Protocol::IPv4, HOST, PORT));
+	ASSERT_TRUE(fn_name, busy.Connect(Net::Connection::Protocol::IPv4, HOST, PORT));
+
+	// Over max_connections: closed right after accept, so requests fail
+	rejected.Connect(Net::Connection::Protocol::IPv4, HOST, PORT);
+	ASSERT_TRUE(fn_name, !rejected.RequestRandomNumber());
+	ASSERT_TRUE(fn_name, server.Load().rejected_connections >= 1);
+	ASSERT_EQUAL(fn_name, server.Load().connections, std::size_t(2));
+
+	// Over max_requests: answered with Busy while the slow request runs
+	std::thread slow_request([&slow] {
+		(void)slow.RequestNameList(3);
+	});
+	std::this_thread::sleep_for(std::chrono::milliseconds(200));
+	ASSERT_TRUE(fn_name, !busy.RequestRandomNumber());
+	ASSERT_TRUE(fn_name, busy.ServerBusy());
+	slow_request.join();
+
+	// Load is gone, so the same client is served again
+	ASSERT_TRUE(fn_name, busy.RequestRandomNumber().has_value());
+	ASSERT_TRUE(fn_name, !busy.ServerBusy());
+	ASSERT_EQUAL(fn_name, server.Load().shed_requests, std::uint64_t(1));
+	// The worker releases its request right after replying
+	for (int i = 0; i < 100 && server.Load().requests > 0; ++i)
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	ASSERT_EQUAL(fn_name, server.Load().requests, std::size_t(0));
+
+	rejected.Disconnect();
+	busy.Disconnect();
+	slow.Disconnect();
+	server.Disconnect();
+	RETURN_TEST(fn_name, 0);
+}
+
+int TestRateLimit() {
+	const std::string fn_name = "TestRateLimit";
+
+	Test::RateLimitedServer server(logger);
+	if (!server.Connect(Net::Connection::Protocol::IPv4, HOST, PORT)) {
+		logger << Level::Error << fn_name << ": server.Connect failed." << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+	Test::NegotiatingClient client(logger);
+	if (!client.Connect(Net::Connection::Protocol::IPv4, HOST, PORT)) {
+		logger << Level::Error << fn_name << ": client.Connect failed." << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+
+	// The burst passes, the next request of the limited opcode is refused
+	ASSERT_TRUE(fn_name, client.RequestRandomNumber().has_value());
+	ASSERT_TRUE(fn_name, client.RequestRandomNumber().has_value());
+	ASSERT_TRUE(fn_name, !client.RequestRandomNumber());
+	ASSERT_TRUE(fn_name, client.ServerBusy());
+	ASSERT_EQUAL(fn_name, server.RateLimitedFrames(), std::uint64_t(1));
+
+	// Other opcodes only share the (unlimited) connection bucket
+	ASSERT_TRUE(fn_name, client.RequestNameList(2).has_value());
+
+	// One token per second refills the bucket
+	std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+	ASSERT_TRUE(fn_name, client.RequestRandomNumber().has_value());
+
+	client.Disconnect();
+	server.Disconnect();
+	RETURN_TEST(fn_name, 0);
+}
+
+int TestDispatchedRequests() {
+	const std::string fn_name = "TestDispatchedRequests";
+
+	Test::DispatchingServer server(logger);
+	if (!server.Connect(Net::Connection::Protocol::IPv4, HOST, PORT)) {
+		logger << Level::Error << fn_name << ": server.Connect failed." << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+	std::vector<std::unique_ptr<Test::Client>> bulk_clients;
+	for (int i = 0; i < 3; ++i) {
+		bulk_clients.push_back(std::make_unique<Test::Client>(logger));
+		ASSERT_TRUE(fn_name, bulk_clients.back()->Connect(Net::Connection::Protocol::IPv4, HOST, PORT));
+	}
+	Test::Client interactive(logger);
+	ASSERT_TRUE(fn_name, interactive.Connect(Net::Connection::Protocol::IPv4, HOST, PORT));
+
+	// Three slow bulk requests share the bulk class's single thread
+	std::atomic<int> bulk_ok { 0 };
+	std::vector<std::thread> bulk_requests;
+	for (auto& client : bulk_clients) {
+		bulk_requests.emplace_back([&client, &bulk_ok] {
+			auto names = client->RequestNameList(2);
+			if (names && names->size() == 2)
+				++bulk_ok;
+		});
+	}
+
+	// The interactive class has its own thread, so it is not queued behind them
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	const auto start = std::chrono::steady_clock::now();
+	ASSERT_TRUE(fn_name, interactive.RequestRandomNumber().has_value());
+	ASSERT_TRUE(fn_name, std::chrono::steady_clock::now() - start < std::chrono::milliseconds(250));
+
+	for (auto& request : bulk_requests)
+		request.join();
+	ASSERT_EQUAL(fn_name, bulk_ok.load(), 3);
+	ASSERT_EQUAL(fn_name, server.bulk_peak.load(), 1);
+
+	interactive.Disconnect();
+	for (auto& client : bulk_clients)
+		client->Disconnect();
+	server.Disconnect();
+	RETURN_TEST(fn_name, 0);
+}
+
+int TestStagedExecution() {
+	const std::string fn_name = "TestStagedExecution";
+
+	Test::StagedServer server(logger);
+	if (!server.Connect(Net::Connection::Protocol::IPv4, HOST, PORT)) {
+		logger << Level::Error << fn_name << ": server.Connect failed." << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+	std::vector<std::unique_ptr<Test::Client>> clients;
+	for (int i = 0; i < 4; ++i) {
+		clients.push_back(std::make_unique<Test::Client>(logger));
+		ASSERT_TRUE(fn_name, clients.back()->Connect(Net::Connection::Protocol::IPv4, HOST, PORT));
+	}
+
+	// Plain and batched requests from four connections, decoded and handled by two stage threads
+	std::atomic<int> ok { 0 };
+	std::vector<std::thread> requests;
+	for (auto& client : clients) {
+		requests.emplace_back([&client, &ok] {
+			auto names = client->RequestNameList(2);
+			auto numbers = client->RequestRandomNumbers(20);
+			if (names && names->size() == 2 && numbers && numbers->size() == 20)
+				++ok;
+		});
+	}
+	for (auto& request : requests)
+		request.join();
+	ASSERT_EQUAL(fn_name, ok.load(), 4);
+	{
+		std::scoped_lock lock(server.threads_mutex);
+		ASSERT_TRUE(fn_name, server.handler_threads.size() <= 2);
+	}
+	const Net::Connection::SchedulerStats stats = server.SchedulerStats();
+	ASSERT_TRUE(fn_name, stats.executed >= 8);
+	ASSERT_EQUAL(fn_name, stats.queue_depths.size(), std::size_t(2));
+
+	for (auto& client : clients)
+		client->Disconnect();
+	server.Disconnect();
+	RETURN_TEST(fn_name, 0);
+}
+
+int TestShardedRequests() {
+	const std::string fn_name = "TestShardedRequests";
+
+	Test::ShardedServer server(logger);
+	if (!server.Connect(Net::Connection::Protocol::IPv4, HOST, PORT)) {
+		logger << Level::Error << fn_name << ": server.Connect failed." << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+	std::vector<std::unique_ptr<Test::Client>> clients;
+	for (int i = 0; i < 4; ++i) {
+		clients.push_back(std::make_unique<Test::Client>(logger));
+		ASSERT_TRUE(fn_name, clients.back()->Connect(Net::Connection::Protocol::IPv4, HOST, PORT));
+	}
+
+	// Every client asks for both keys, so each key is requested from several connections at once
+	std::atomic<int> ok { 0 };
+	std::vector<std::thread> requests;
+	for (std::size_t i = 0; i < clients.size(); ++i) {
+		requests.emplace_back([&client = clients[i], &ok, i] {
+			for (std::size_t j = 0; j < 5; ++j) {
+				const std::size_t key = (i + j) % 2 + 1;
+				auto names = client->RequestNameList(key);
+				if (names && names->size() == key)
+					++ok;
+			}
+		});
+	}
+	for (auto& request : requests)
+		request.join();
+	ASSERT_EQUAL(fn_name, ok.load(), 20);
+
+	// One key at a time on one fixed thread; both keys in parallel
+	ASSERT_EQUAL(fn_name, server.key_peak.load(), 1);
+	ASSERT_EQUAL(fn_name, server.total_peak.load(), 2);
+	{
+		std::scoped_lock lock(server.shards_mutex);
+		ASSERT_EQUAL(fn_name, server.key_threads[1].size(), std::size_t(1));
+		ASSERT_EQUAL(fn_name, server.key_threads[2].size(), std::size_t(1));
+		ASSERT_TRUE(fn_name, *server.key_threads[1].begin() != *server.key_threads[2].begin());
+	}
+
+	for (auto& client : clients)
+		client->Disconnect();
+	server.Disconnect();
+	RETURN_TEST(fn_name, 0);
+}
+
+int TestThreadPerCore() {
+	const std::string fn_name = "TestThreadPerCore";
+
+	Test::ThreadPerCoreServer server(logger);
+	if (!server.Connect(Net::Connection::Protocol::IPv4, HOST, PORT)) {
+		logger << Level::Error << fn_name << ": server.Connect failed." << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+	std::vector<std::unique_ptr<Test::Client>> clients;
+	for (int i = 0; i < 3; ++i) {
+		clients.push_back(std::make_unique<Test::Client>(logger));
+		ASSERT_TRUE(fn_name, clients.back()->Connect(Net::Connection::Protocol::IPv4, HOST, PORT));
+		auto names = clients.back()->RequestNameList(2);
+		ASSERT_TRUE(fn_name, names.has_value() && names->size() == 2);
+	}
+
+	// Connections go to the least loaded core
+	ASSERT_TRUE(fn_name, server.CoreConnections() == std::vector<std::size_t>({ 2, 1 }));
+
+	for (auto& client : clients)
+		client->Disconnect();
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+	while (server.CoreConnections() != std::vector<std::size_t>({ 0, 0 }) && std::chrono::steady_clock::now() < deadline)
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	ASSERT_TRUE(fn_name, server.CoreConnections() == std::vector<std::size_t>({ 0, 0 }));
+
+	server.Disconnect();
+	RETURN_TEST(fn_name, 0);
+}
+
+int TestTimeouts() {
+	const std::string fn_name = "TestTimeouts";
+
+	Test::IdleTimeoutServer server(logger);
+	if (!server.Connect(Net::Connection::Protocol::IPv4, HOST, PORT)) {
+		logger << Level::Error << fn_name << ": server.Connect failed." << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+	// Requests more often than the idle timeout keep the connection open
+	Test::Client client(logger);
+	ASSERT_TRUE(fn_name, client.Connect(Net::Connection::Protocol::IPv4, HOST, PORT));
+	for (int i = 0; i < 6; ++i) {
+		ASSERT_TRUE(fn_name, client.RequestRandomNumber().has_value());
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	}
+	ASSERT_EQUAL(fn_name, server.IdleClients(), std::uint64_t(0));
+
+	// Silent for longer than the timeout: the server closes the connection
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+	while (server.IdleClients() == 0 && std::chrono::steady_clock::now() < deadline)
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	ASSERT_EQUAL(fn_name, server.IdleClients(), std::uint64_t(1));
+	ASSERT_TRUE(fn_name, !client.RequestRandomNumber().has_value());
+	client.Disconnect();
+
+	// A reply slower than the request timeout fails the request and closes the connection
+	Test::ImpatientClient impatient(logger);
+	ASSERT_TRUE(fn_name, impatient.Connect(Net::Connection::Protocol::IPv4, HOST, PORT));
+	ASSERT_TRUE(fn_name, impatient.RequestRandomNumber().has_value());
+	const auto start = std::chrono::steady_clock::now();
+	ASSERT_TRUE(fn_name, !impatient.RequestNameList(2).has_value());
+	ASSERT_TRUE(fn_name, std::chrono::steady_clock::now() - start < std::chrono::milliseconds(400));
+	ASSERT_TRUE(fn_name, impatient.Status() == Net::Connection::Status::Disconnected);
+
+	server.Disconnect();
+	RETURN_TEST(fn_name, 0);
+}
+
+int TestHeartbeats() {
+	const std::string fn_name = "TestHeartbeats";
+
+	Test::HeartbeatServer server(logger);
+	if (!server.Connect(Net::Connection::Protocol::IPv4, HOST, PORT)) {
+		logger << Level::Error << fn_name << ": server.Connect failed." << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+	Test::HeartbeatClient client(logger);
+	ASSERT_TRUE(fn_name, client.Connect(Net::Connection::Protocol::IPv4, HOST, PORT));
+	ASSERT_TRUE(fn_name, client.RequestRandomNumber().has_value());
+	const std::uint64_t packed_id = server.last_client.load();
+	const Net::Connection::ID client_id(static_cast<std::uint32_t>(packed_id), static_cast<std::uint32_t>(packed_id >> 32));
+
+	// Polling answers the server's pings, which keeps the connection alive
+	const auto polling_until = std::chrono::steady_clock::now() + std::chrono::milliseconds(800);
+	while (std::chrono::steady_clock::now() < polling_until)
+		client.Poll(50);
+	ASSERT_EQUAL(fn_name, server.UnresponsiveClients(), std::uint64_t(0));
+	auto server_rtt = server.ClientRoundTrip(client_id);
+	ASSERT_TRUE(fn_name, server_rtt.has_value() && server_rtt->samples >= 3);
+	ASSERT_TRUE(fn_name, server_rtt->min <= server_rtt->smoothed);
+
+	// Client side measurement
+	ASSERT_TRUE(fn_name, client.Ping().has_value());
+	ASSERT_EQUAL(fn_name, client.RoundTrip().samples, std::uint64_t(1));
+
+	// A client that stops reading looks like a dead peer
+	const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+	while (server.UnresponsiveClients() == 0 && std::chrono::steady_clock::now() < deadline)
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	ASSERT_EQUAL(fn_name, server.UnresponsiveClients(), std::uint64_t(1));
+	ASSERT_TRUE(fn_name, !server.ClientRoundTrip(client_id).has_value());
+
+	client.Disconnect();
+	server.Disconnect();
+	RETURN_TEST(fn_name, 0);
+}
+
+int TestDialing() {
+	const std::string fn_name = "TestDialing";
+
+	Test::Server server(logger);
+	if (!server.Connect(Net::Connection::Protocol::IPv4, HOST, PORT)) {
+		logger << Level::Error << fn_name << ": server.Connect failed." << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+	// Any family: every address of the host is tried until one answers
+	Test::HastyDialClient client(logger);
+	ASSERT_TRUE(fn_name, client.Connect(Net::Connection::Protocol::Any, HOST, PORT));
+	ASSERT_TRUE(fn_name, client.RequestRandomNumber().has_value());
+	client.Disconnect();
+
+	// Later connects to the same host reuse the cached addresses
+	ASSERT_TRUE(fn_name, client.Connect(Net::Connection::Protocol::Any, HOST, PORT));
+	client.Disconnect();
+
+	// Names that do not resolve fail (and are remembered as failures)
+	Test::HastyDialClient unknown(logger);
+	ASSERT_TRUE(fn_name, !unknown.Connect(Net::Connection::Protocol::IPv4, "unknown-host.invalid", PORT));
+	ASSERT_TRUE(fn_name, !unknown.Connect(Net::Connection::Protocol::IPv4, "unknown-host.invalid", PORT));
+
+	// Nobody listening: the refusal comes back without waiting for the deadline
+	Test::HastyDialClient refused(logger);
+	ASSERT_TRUE(fn_name, !refused.Connect(Net::Connection::Protocol::IPv4, HOST, PORT + 1));
+
+	// A black-holed address gives up at the dial deadline instead of the system's
+	Test::HastyDialClient unreachable(logger);
+	const auto start = std::chrono::steady_clock::now();
+	ASSERT_TRUE(fn_name, !unreachable.Connect(Net::Connection::Protocol::IPv4, "10.255.255.1", PORT));
+	ASSERT_TRUE(fn_name, std::chrono::steady_clock::now() - start < std::chrono::seconds(2));
+
+	server.Disconnect();
+	RETURN_TEST(fn_name, 0);
+}
+
+int TestClientPool() {
+	const std::string fn_name = "TestClientPool";
+
+	Test::Server server(logger);
+	if (!server.Connect(Net::Connection::Protocol::IPv4, HOST, PORT)) {
+		logger << Level::Error << fn_name << ": server.Connect failed." << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+	Net::Connection::PoolOptions options;
+	options.min_connections = 1;
+	options.max_connections = 2;
+	options.acquire_timeout = 200;
+	Net::ClientPool pool([] { return std::make_unique<Test::Client>(logger); }, options, logger);
+
+	// Warm connections are handed out without connecting
+	ASSERT_EQUAL(fn_name, pool.Warm(Net::Connection::Protocol::IPv4, HOST, PORT), std::size_t(1));
+	ASSERT_EQUAL(fn_name, pool.Stats().idle, std::size_t(1));
+	{
+		auto first = pool.Acquire(Net::Connection::Protocol::IPv4, HOST, PORT);
+		auto second = pool.Acquire(Net::Connection::Protocol::IPv4, HOST, PORT);
+		ASSERT_TRUE(fn_name, first && second);
+		ASSERT_TRUE(fn_name, first.As<Test::Client>().RequestRandomNumber().has_value());
+		ASSERT_TRUE(fn_name, second.As<Test::Client>().RequestRandomNumber().has_value());
+		ASSERT_EQUAL(fn_name, pool.Stats().created, std::uint64_t(2));
+
+		// At the limit: wait for a returned connection, or give up
+		ASSERT_TRUE(fn_name, !pool.Acquire(Net::Connection::Protocol::IPv4, HOST, PORT));
+		std::thread returner([&first] {
+			std::this_thread::sleep_for(std::chrono::milliseconds(50));
+			first = {};
+		});
+		auto third = pool.Acquire(Net::Connection::Protocol::IPv4, HOST, PORT);
+		returner.join();
+		ASSERT_TRUE(fn_name, third && third.As<Test::Client>().RequestRandomNumber().has_value());
+
+		// A broken connection is evicted instead of returned
+		second.Discard();
+	}
+
+	const Net::Connection::PoolStats stats = pool.Stats(Net::Connection::Protocol::IPv4, HOST, PORT);
+	ASSERT_EQUAL(fn_name, stats.idle, std::size_t(1));
+	ASSERT_EQUAL(fn_name, stats.in_use, std::size_t(0));
+	ASSERT_EQUAL(fn_name, stats.created, std::uint64_t(2));
+	ASSERT_EQUAL(fn_name, stats.evicted, std::uint64_t(1));
+	ASSERT_EQUAL(fn_name, stats.acquired, std::uint64_t(3));
+	ASSERT_EQUAL(fn_name, stats.waited, std::uint64_t(2));
+	ASSERT_EQUAL(fn_name, stats.failed, std::uint64_t(1));
+	ASSERT_TRUE(fn_name, stats.wait_max >= std::chrono::milliseconds(200));
+
+	pool.Close();
+	ASSERT_TRUE(fn_name, !pool.Acquire(Net::Connection::Protocol::IPv4, HOST, PORT));
+	server.Disconnect();
+	RETURN_TEST(fn_name, 0);
+}
+
+int TestPublishSubscribe() {
+	const std::string fn_name = "TestPublishSubscribe";
+
+	Test::PublishingServer server(logger);
+	if (!server.Connect(Net::Connection::Protocol::IPv4, HOST, PORT)) {
+		logger << Level::Error << fn_name << ": server.Connect failed." << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+	Test::SubscribingClient client(logger);
+	if (!client.Connect(Net::Connection::Protocol::IPv4, HOST, PORT)) {
+		logger << Level::Error << fn_name << ": client.Connect failed." << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+
+	ASSERT_TRUE(fn_name, client.Subscribe("numbers"));
+	ASSERT_EQUAL(fn_name, server.PublishNumber("numbers", 42), std::size_t(1));
+	ASSERT_EQUAL(fn_name, server.PublishNumber("others", 7), std::size_t(0));
+	client.Poll(2000);
+	ASSERT_EQUAL(fn_name, client.published.size(), std::size_t(1));
+	ASSERT_TRUE(fn_name, client.published[0] == std::make_pair(std::string("numbers"), 42));
+
+	// Publications arriving while waiting for a reply are handled, not taken as the reply
+	ASSERT_EQUAL(fn_name, server.PublishNumber("numbers", 43), std::size_t(1));
+	auto names_expected = client.RequestNameList(2);
+	if (!names_expected) {
+		logger << Level::Error << fn_name << ": RequestNameList failed: " << names_expected.error()->what() << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+	ASSERT_EQUAL(fn_name, names_expected->size(), std::size_t(2));
+	if (client.published.size() < 2)
+		client.Poll(2000);
+	ASSERT_EQUAL(fn_name, client.published.size(), std::size_t(2));
+	ASSERT_EQUAL(fn_name, client.published[1].second, 43);
+
+	ASSERT_TRUE(fn_name, client.Unsubscribe("numbers"));
+	ASSERT_EQUAL(fn_name, server.PublishNumber("numbers", 44), std::size_t(0));
+
+	client.Disconnect();
+	server.Disconnect();
+	RETURN_TEST(fn_name, 0);
+}
+
+int TestCompressedRequests() {
+	const std::string fn_name = "TestCompressedRequests";
+
+	Test::CompressedServer server(logger);
+	if (!server.Connect(Net::Connection::Protocol::IPv4, HOST, PORT)) {
+		logger << Level::Error << fn_name << ": server.Connect failed." << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+	Test::CompressedClient client(logger);
+	if (!client.Connect(Net::Connection::Protocol::IPv4, HOST, PORT)) {
+		logger << Level::Error << fn_name << ": client.Connect failed." << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+
+	ASSERT_EQUAL(fn_name, client.Capabilities().version, Net::Connection::Capabilities::PROTOCOL_VERSION);
+	ASSERT_TRUE(fn_name, client.Capabilities().Has(Net::Connection::Feature::Compression));
+	ASSERT_TRUE(fn_name, client.Capabilities().Has(Net::Connection::Feature::Checksum));
+
+	const std::size_t amount = 50;
+	auto names_expected = client.RequestNameList(amount);
+	if (!names_expected) {
+		logger << Level::Error << fn_name << ": RequestNameList failed: " << names_expected.error()->what() << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+	ASSERT_EQUAL(fn_name, names_expected->size(), amount);
+	ASSERT_TRUE(fn_name, names_expected->back() == "Name_" + std::to_string(amount));
+
+	auto data_expected = client.RequestLargeDataEcho(large_data_size);
+	if (!data_expected) {
+		logger << Level::Error << fn_name << ": RequestLargeDataEcho failed: " << data_expected.error()->what() << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+	ASSERT_EQUAL(fn_name, data_expected->size(), large_data_size);
+	ASSERT_TRUE(fn_name, data_expected->find_first_not_of(large_data_repeat_char) == std::string::npos);
+
+	client.Disconnect();
+	server.Disconnect();
+	RETURN_TEST(fn_name, 0);
+}
+
+int TestChunkedPipeline() {
+	const std::string fn_name = "TestChunkedPipeline";
+
+	Test::NegotiatingServer server(logger);
+	if (!server.Connect(Net::Connection::Protocol::IPv4, HOST, PORT)) {
+		logger << Level::Error << fn_name << ": server.Connect failed." << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+	Test::NegotiatingClient client(logger);
+	if (!client.Connect(Net::Connection::Protocol::IPv4, HOST, PORT)) {
+		logger << Level::Error << fn_name << ": client.Connect failed." << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+	ASSERT_TRUE(fn_name, client.Capabilities().Has(Net::Connection::Feature::FrameFlags));
+
+	// Several chunks plus a partial one; a position-dependent pattern catches reordered chunks
+	const std::size_t size = 3 * Transport::Frame::PARALLEL_THRESHOLD + 12345;
+	std::string sent(size, '\0');
+	for (std::size_t i = 0; i < size; ++i)
+		sent[i] = static_cast<char>((i * 31 + i / 4096) & 0xFF);
+
+	auto data_expected = client.RequestDataEcho(sent);
+	if (!data_expected) {
+		logger << Level::Error << fn_name << ": RequestDataEcho failed: " << data_expected.error()->what() << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+	ASSERT_EQUAL(fn_name, data_expected->size(), size);
+	ASSERT_TRUE(fn_name, data_expected.value() == sent);
+
+	client.Disconnect();
+	server.Disconnect();
+	RETURN_TEST(fn_name, 0);
+}
+
+int TestCRC32C() {
+	const std::string fn_name = "TestCRC32C";
+	auto bytes = [](const std::string& data) {
+		return std::as_bytes(std::span<const char>(data.data(), data.size()));
+	};
+
+	// Known answers: the standard check value and the RFC 3720 (iSCSI) vectors
+	std::string incrementing(32, '\0');
+	for (std::size_t i = 0; i < incrementing.size(); ++i)
+		incrementing[i] = static_cast<char>(i);
+	const std::vector<std::pair<std::string, std::uint32_t>> vectors {
+		{ "123456789", 0xE3069283u },
+		{ std::string(32, '\0'), 0x8A9136AAu },
+		{ std::string(32, '\xFF'), 0x62A8AB43u },
+		{ incrementing, 0x46DD794Eu },
+	};
+	for (const auto& [data, crc] : vectors) {
+		ASSERT_EQUAL(fn_name, Transport::CRC32C::Compute(bytes(data)), crc);
+		ASSERT_EQUAL(fn_name, Transport::CRC32C::ComputePortable(bytes(data)), crc);
+	}
+	logger << Level::Info << fn_name << ": hardware CRC " << (Transport::CRC32C::Accelerated() ? "in use" : "not available") << std::endl;
+
+	// Every alignment and tail length, whole and fed in two parts, must match the table implementation
+	std::string data(256 + 8, '\0');
+	for (std::size_t i = 0; i < data.size(); ++i)
+		data[i] = static_cast<char>((i * 131 + 7) & 0xFF);
+	for (std::size_t offset = 0; offset < 8; ++offset) {
+		for (std::size_t length = 0; length <= 256; ++length) {
+			const std::span<const std::byte> span = bytes(data).subspan(offset, length);
+			const std::uint32_t reference = Transport::CRC32C::ComputePortable(span);
+			ASSERT_EQUAL(fn_name, Transport::CRC32C::Compute(span), reference);
+
+			Transport::CRC32C crc;
+			crc.Update(span.first(length / 3));
+			crc.Update(span.subspan(length / 3));
+			ASSERT_EQUAL(fn_name, crc.Value(), reference);
+		}
+	}
+	RETURN_TEST(fn_name, 0);
+}
+
+int TestFrameChecksum() {
+	const std::string fn_name = "TestFrameChecksum";
+
+	Net::Socket::Server listener(Net::Connection::Protocol::IPv4, logger);
+	auto [sender, receiver] = Test::SocketPair(listener);
+	if (!sender || !receiver) {
+		logger << Level::Error << fn_name << ": could not connect a socket pair." << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+
+	const Transport::Codec codec(Transport::Compression::Options {});
+	Pipeline pipeline;
+	constexpr std::size_t HEADER_SIZE = sizeof(Transport::Packet::OpcodeType) + sizeof(std::size_t);
+	enum class Corruption { None, Payload, Trailer };
+
+	// A processed opcode (checked after decoding) and an unprocessed one (checked while received)
+	const Test::Packet::AskNameList processed(12345);
+	const Test::Packet::LowOpcode unprocessed(1, "unprocessed payload");
+	for (const Transport::Packet* packet : { static_cast<const Transport::Packet*>(&processed), static_cast<const Transport::Packet*>(&unprocessed) }) {
+		for (const Corruption corruption : { Corruption::None, Corruption::Payload, Corruption::Trailer }) {
+			Transport::Frame frame(*packet);
+			DataType wire;
+			frame.ProcessOutput(pipeline, codec, static_cast<std::uint8_t>(Transport::Frame::Flag::Checksum), 0, logger).ExtractUntilEoF(wire);
+			ASSERT_TRUE(fn_name, wire.size() > HEADER_SIZE + sizeof(std::uint32_t));
+			if (corruption == Corruption::Payload)
+				wire[HEADER_SIZE] ^= std::byte { 0x01 };
+			else if (corruption == Corruption::Trailer)
+				wire.back() ^= std::byte { 0x01 };
+
+			ASSERT_TRUE(fn_name, sender->Send(wire).has_value());
+			Transport::Frame received = Transport::Frame::ProcessInput(receiver, pipeline, codec, 0, 0, logger);
+			// A rejected frame comes back empty (opcode 0)
+			ASSERT_EQUAL(fn_name, received.Opcode() == packet->Opcode(), corruption == Corruption::None);
+		}
+	}
+
+	sender->Disconnect();
+	receiver->Disconnect();
+	RETURN_TEST(fn_name, 0);
+}
+
+int TestLegacyLowOpcodes() {
+	const std::string fn_name = "TestLegacyLowOpcodes";
+
+	// Handshake enabled on the server only: the client is a legacy peer using opcodes now reserved for control frames
+	Test::NegotiatingServer server(logger);
+	if (!server.Connect(Net::Connection::Protocol::IPv4, HOST, PORT)) {
+		logger << Level::Error << fn_name << ": server.Connect failed." << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+	Test::Client client(logger);
+	if (!client.Connect(Net::Connection::Protocol::IPv4, HOST, PORT)) {
+		logger << Level::Error << fn_name << ": client.Connect failed." << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+
+	for (const auto& control : { Transport::Control::Hello, Transport::Control::Batch, Transport::Control::Publish }) {
+		const auto opcode = static_cast<Transport::Packet::OpcodeType>(control);
+		const std::string text = "legacy opcode " + std::to_string(opcode);
+		auto echo_expected = client.RequestLowOpcodeEcho(opcode, text);
+		if (!echo_expected) {
+			logger << Level::Error << fn_name << ": RequestLowOpcodeEcho failed: " << echo_expected.error()->what() << std::endl;
+			RETURN_TEST(fn_name, 1);
+		}
+		ASSERT_TRUE(fn_name, echo_expected.value() == text);
+	}
+	ASSERT_EQUAL(fn_name, client.Capabilities().version, 0);
+
+	client.Disconnect();
+	server.Disconnect();
+	RETURN_TEST(fn_name, 0);
+}
+
+int TestResolver() {
+	const std::string fn_name = "TestResolver";
+	using Net::Connection::Resolver;
+	constexpr auto NEGATIVE_TTL = std::chrono::milliseconds(50);
+
+	// Queries wait for the gate so concurrent lookups overlap; unknown names fail shortly
+	std::atomic<int> queries { 0 };
+	std::promise<void> gate;
+	std::shared_future<void> opened = gate.get_future().share();
+	Resolver resolver([&queries, opened](const std::string& hostname, const Net::Connection::Protocol&) {
+		queries.fetch_add(1);
+		opened.wait();
+		Resolver::Answer answer;
+		if (hostname == "known") {
+			answer.addresses.push_back(sockaddr_storage {});
+			answer.expiry = std::chrono::steady_clock::now() + std::chrono::seconds(60);
+		}
+		else {
+			answer.error = "unknown host";
+			answer.expiry = std::chrono::steady_clock::now() + NEGATIVE_TTL;
+		}
+		return std::make_shared<const Resolver::Answer>(std::move(answer));
+	});
+
+	// Shared in-flight query
+	auto first = resolver.Lookup("known", Net::Connection::Protocol::IPv4);
+	auto second = resolver.Lookup("known", Net::Connection::Protocol::IPv4);
+	ASSERT_TRUE(fn_name, second.wait_for(std::chrono::milliseconds(10)) == std::future_status::timeout);
+	gate.set_value();
+	ASSERT_TRUE(fn_name, first.get() == second.get());
+	ASSERT_EQUAL(fn_name, queries.load(), 1);
+
+	// Cache hit: ready at once, no new query
+	auto cached = resolver.Lookup("known", Net::Connection::Protocol::IPv4);
+	ASSERT_TRUE(fn_name, cached.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+	ASSERT_TRUE(fn_name, cached.get() == first.get());
+	ASSERT_EQUAL(fn_name, queries.load(), 1);
+
+	// Families are cached apart
+	ASSERT_FALSE(fn_name, resolver.Lookup("known", Net::Connection::Protocol::IPv6).get()->addresses.empty());
+	ASSERT_EQUAL(fn_name, queries.load(), 2);
+
+	// Failures are cached until their negative TTL expires
+	auto failed = resolver.Lookup("unknown", Net::Connection::Protocol::IPv4).get();
+	ASSERT_TRUE(fn_name, failed->addresses.empty());
+	ASSERT_TRUE(fn_name, resolver.Lookup("unknown", Net::Connection::Protocol::IPv4).get() == failed);
+	ASSERT_EQUAL(fn_name, queries.load(), 3);
+	std::this_thread::sleep_for(NEGATIVE_TTL * 2);
+	auto retried = resolver.Lookup("unknown", Net::Connection::Protocol::IPv4).get();
+	ASSERT_TRUE(fn_name, retried != failed);
+	ASSERT_TRUE(fn_name, retried->addresses.empty());
+	ASSERT_EQUAL(fn_name, queries.load(), 4);
+
+	RETURN_TEST(fn_name, 0);
+}
+
+int TestShardedRegistry() {
+	const std::string fn_name = "TestShardedRegistry";
+	using Net::Connection::ID;
+	constexpr std::size_t SHARDS = 4;
+	Net::Connection::ShardedRegistry<int, SHARDS> registry;
+
+	// One thread's inserts rotate over every shard; the shard lives in the low index bits
+	std::vector<ID> ids;
+	std::set<std::size_t> shards;
+	for (int value = 0; value < static_cast<int>(2 * SHARDS); ++value) {
+		ids.push_back(registry.Insert(int(value)));
+		shards.insert(ids.back().Index() & (SHARDS - 1));
+	}
+	ASSERT_EQUAL(fn_name, shards.size(), SHARDS);
+	ASSERT_EQUAL(fn_name, std::set<ID>(ids.begin(), ids.end()).size(), ids.size());
+	ASSERT_EQUAL(fn_name, registry.Size(), ids.size());
+
+	// Global IDs map back to the value stored under them, also through ForEach
+	for (std::size_t i = 0; i < ids.size(); ++i) {
+		int found = -1;
+		ASSERT_TRUE(fn_name, registry.Read(ids[i], [&found](const int& value) { found = value; }));
+		ASSERT_EQUAL(fn_name, found, static_cast<int>(i));
+	}
+	std::map<ID, int> visited;
+	registry.ForEach([&visited](const ID& id, int& value) { visited[id] = value; });
+	ASSERT_EQUAL(fn_name, visited.size(), ids.size());
+	for (std::size_t i = 0; i < ids.size(); ++i)
+		ASSERT_EQUAL(fn_name, visited[ids[i]], static_cast<int>(i));
+
+	// Reusing a slot bumps its generation: the old ID no longer reaches the new value
+	const ID stale = ids.front();
+	ASSERT_TRUE(fn_name, registry.Erase(stale).value() == 0);
+	ID reused;
+	for (std::size_t i = 0; i < SHARDS && reused.Index() != stale.Index(); ++i)
+		reused = registry.Insert(100 + static_cast<int>(i));
+	ASSERT_EQUAL(fn_name, reused.Index(), stale.Index());
+	ASSERT_TRUE(fn_name, reused.Generation() != stale.Generation());
+
+	bool called = false;
+	ASSERT_FALSE(fn_name, registry.Read(stale, [&called](const int&) { called = true; }));
+	ASSERT_FALSE(fn_name, registry.Modify(stale, [&called](int&) { called = true; }));
+	ASSERT_FALSE(fn_name, registry.Erase(stale).has_value());
+	ASSERT_FALSE(fn_name, called);
+	ASSERT_FALSE(fn_name, registry.Read(ID(), [&called](const int&) { called = true; }));
+
+	ASSERT_TRUE(fn_name, registry.Modify(reused, [](int& value) { value = -1; }));
+	int found = 0;
+	ASSERT_TRUE(fn_name, registry.Read(reused, [&found](const int& value) { found = value; }));
+	ASSERT_EQUAL(fn_name, found, -1);
+	ASSERT_TRUE(fn_name, registry.Erase(reused).value() == -1);
+
+	RETURN_TEST(fn_name, 0);
+}
+
+int TestCompressionStages() {
+	const std::string fn_name = "TestCompressionStages";
+	using Transport::Compression::Algorithm;
+	const Algorithm algorithm = Transport::Compression::IsAvailable(Algorithm::LZ4) ? Algorithm::LZ4 : Algorithm::None;
+
+	// Compresses then decompresses @p data through the public stages
+	auto round_trip = [](const Algorithm& algorithm, const std::string& data, const std::size_t& max_size) {
+		Pipeline pipeline;
+		pipeline.AddPipe(Transport::Compression::Compressor(algorithm));
+		pipeline.AddPipe(Transport::Compression::Decompressor(max_size));
+		Producer producer;
+		producer.Write(DataType(reinterpret_cast<const std::byte*>(data.data()), reinterpret_cast<const std::byte*>(data.data()) + data.size()));
+		producer.Close();
+		Consumer consumer = pipeline.Process(producer.Consumer(), ExecutionMode::Sync, logger);
+		DataType result;
+		consumer.ExtractUntilEoF(result);
+		return std::string(reinterpret_cast<const char*>(result.data()), result.size());
+	};
+
+	std::string sent;
+	for (std::size_t i = 0; i < 100000; ++i)
+		sent += "block " + std::to_string(i % 100) + ";";
+	ASSERT_TRUE(fn_name, round_trip(algorithm, sent, Transport::Compression::DEFAULT_MAX_SIZE) == sent);
+
+	// The header claims more than allowed: rejected before the block is expanded
+	ASSERT_TRUE(fn_name, round_trip(algorithm, sent, sent.size() - 1).empty());
+	ASSERT_TRUE(fn_name, round_trip(Algorithm::None, sent, sent.size() / 2).empty());
+	RETURN_TEST(fn_name, 0);
+}
+
+int TestHandshakeLegacyFallback() {
+	const std::string fn_name = "TestHandshakeLegacyFallback";
+
+	// Server without handshake: the client must fall back to a plain connection
+	Test::Server server(logger);
+	if (!server.Connect(Net::Connection::Protocol::IPv4, HOST, PORT)) {
+		logger << Level::Error << fn_name << ": server.Connect failed." << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+	Test::CompressedClient client(logger);
+	if (!client.Connect(Net::Connection::Protocol::IPv4, HOST, PORT)) {
+		logger << Level::Error << fn_name << ": client.Connect failed." << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+	ASSERT_EQUAL(fn_name, client.Capabilities().version, 0);
+	ASSERT_TRUE(fn_name, !client.Capabilities().Has(Net::Connection::Feature::FrameFlags));
+
+	auto names_expected = client.RequestNameList(5);
+	if (!names_expected) {
+		logger << Level::Error << fn_name << ": RequestNameList failed: " << names_expected.error()->what() << std::endl;
+		RETURN_TEST(fn_name, 1);
+	}
+	ASSERT_EQUAL(fn_name, names_expected->size(), std::size_t(5));
+
+	client.Disconnect();
+	server.Disconnect();
+	RETURN_TEST(fn_name, 0);
+}
+
 int main() {
 	int result = 0;
 	result += TestRequestNameList();
 	result += TestRequestRandomNumber();
 	result += TestRequestLargeDataEchoed();
+	result += TestTrivialPacket();
+	result += TestBatchedRequests();
+	result += TestSendQueueBackpressure();
+	result += TestBroadcast();
+	result += TestSlowConsumerEviction();
+	result += TestAdmissionControl();
+	result += TestRateLimit();
+	result += TestDispatchedRequests();
+	result += TestStagedExecution();
+	result += TestShardedRequests();
+	result += TestThreadPerCore();
+	result += TestTimeouts();
+	result += TestHeartbeats();
+	result += TestDialing();
+	result += TestClientPool();
+	result += TestPublishSubscribe();
+	result += TestCompressedRequests();
+	result += TestChunkedPipeline();
+	result += TestHandshakeLegacyFallback();
+	result += TestLegacyLowOpcodes();
+	result += TestCompressionStages();
+	result += TestCRC32C();
+	result += TestFrameChecksum();
+	result += TestResolver();
+	result += TestShardedRegistry();
 
 	if (result == 0) {
 		std::cout << "All tests passed!" << std::endl;
@@ -0,0 +1,112 @@
+#include <StormByte/network/connection/sharded_registry.hxx>
+
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+// Connection churn benchmark: single-mutex registry (previous Server layout) vs ShardedRegistry.
+// Every thread accepts (insert), looks up its live peers several times and disconnects (erase).
+
+namespace Net = StormByte::Network;
+using Net::Connection::ID;
+
+namespace {
+	using Value = std::shared_ptr<int>;
+
+	constexpr std::size_t LIVE_PER_THREAD = 64;
+	constexpr std::size_t LOOKUPS_PER_CHURN = 16;
+	constexpr auto DURATION = std::chrono::seconds(2);
+
+	/**
+	 * @brief Previous Server layout: one mutex around one registry.
+	 */
+	class LockedRegistry {
+		public:
+			ID Insert(Value&& value) {
+				std::scoped_lock lock(m_mutex);
+				return m_registry.Insert(std::move(value));
+			}
+
+			template <typename F>
+			bool Read(const ID& id, F&& function) {
+				std::scoped_lock lock(m_mutex);
+				const Value* value = m_registry.Find(id);
+				if (!value)
+					return false;
+				function(*value);
+				return true;
+			}
+
+			std::optional<Value> Erase(const ID& id) {
+				std::scoped_lock lock(m_mutex);
+				return m_registry.Erase(id);
+			}
+
+		private:
+			std::mutex m_mutex;
+			Net::Connection::Registry<Value> m_registry;
+	};
+
+	template <typename R>
+	double Run(R& registry, const std::size_t& threads) {
+		std::atomic<bool> stop { false };
+		std::atomic<std::size_t> operations { 0 };
+
+		std::vector<std::thread> workers;
+		for (std::size_t t = 0; t < threads; ++t) {
+			workers.emplace_back([&registry, &stop, &operations, t] {
+				std::mt19937 gen(static_cast<unsigned int>(t + 1));
+				std::deque<ID> live;
+				std::size_t done = 0;
+				long long sink = 0;
+
+				while (!stop.load(std::memory_order_relaxed)) {
+					live.push_back(registry.Insert(std::make_shared<int>(static_cast<int>(done))));
+					for (std::size_t i = 0; i < LOOKUPS_PER_CHURN; ++i) {
+						const ID& id = live[gen() % live.size()];
+						registry.Read(id, [&sink](const Value& value) { sink += *value; });
+					}
+					if (live.size() > LIVE_PER_THREAD) {
+						registry.Erase(live.front());
+						live.pop_front();
+					}
+					done += LOOKUPS_PER_CHURN + 2;
+				}
+
+				for (const auto& id : live)
+					registry.Erase(id);
+				operations.fetch_add(done + (sink == -1 ? 1 : 0), std::memory_order_relaxed);
+			});
+		}
+
+		std::this_thread::sleep_for(DURATION);
+		stop.store(true);
+		for (auto& worker : workers)
+			worker.join();
+
+		return static_cast<double>(operations.load()) / std::chrono::duration<double>(DURATION).count();
+	}
+}
+
+int main(int argc, char** argv) {
+	const std::size_t threads = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : std::max(2u, std::thread::hardware_concurrency());
+	std::cout << "Registry churn benchmark (" << threads << " threads, "
+			<< LOOKUPS_PER_CHURN << " lookups per insert/erase)" << std::endl;
+
+	LockedRegistry locked;
+	const double locked_ops = Run(locked, threads);
+	std::cout << "  single mutex : " << static_cast<long long>(locked_ops) << " ops/s" << std::endl;
+
+	Net::Connection::ShardedRegistry<Value> sharded;
+	const double sharded_ops = Run(sharded, threads);
+	std::cout << "  sharded      : " << static_cast<long long>(sharded_ops) << " ops/s" << std::endl;
+
+	std::cout << "  speedup      : " << sharded_ops / locked_ops << "x" << std::endl;
+	return EXIT_SUCCESS;
+}